@@ -0,0 +1,60 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Roldan JesusAlejandro <kechuroldanjesus@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+/** @file bench.c
+ ** @brief Implementación de las utilidades comunes para los micro-benchmarks de host.
+ *
+ * Este archivo no incluye clock.h: el tipo clock_t del reloj choca con el de <time.h>.
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#define _POSIX_C_SOURCE 199309L
+
+#include "bench.h"
+#include <stdio.h>
+#include <time.h>
+
+/* === Macros definitions ========================================================================================== */
+
+/* === Private data type declarations ============================================================================== */
+
+/* === Private function declarations =============================================================================== */
+
+/* === Private variable definitions ================================================================================ */
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private function definitions ================================================================================ */
+
+/* === Public function implementation ============================================================================== */
+
+uint64_t BenchNow(void) {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (uint64_t)now.tv_sec * 1000000000u + (uint64_t)now.tv_nsec;
+}
+
+void BenchReport(const char * name, uint64_t elapsed, uint64_t iterations) {
+    double per_iteration = iterations ? (double)elapsed / (double)iterations : 0.0;
+    printf("%-40s %12llu iter %10.3f ms %10.3f ns/iter\n", name, (unsigned long long)iterations,
+           (double)elapsed / 1e6, per_iteration);
+}
+
+/* === End of documentation ======================================================================================== */
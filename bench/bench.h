@@ -0,0 +1,72 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Roldan JesusAlejandro <kechuroldanjesus@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+#ifndef BENCH_H_
+#define BENCH_H_
+
+/** @file bench.h
+ ** @brief Utilidades comunes para los micro-benchmarks de host.
+ *
+ * Los benchmarks se compilan con el gcc del host, fuera de Ceedling y del firmware. Cada archivo bench_*.c indica
+ * en su cabecera la línea de compilación correspondiente.
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include <stdint.h>
+
+/* === Header for C++ compatibility ================================================================================ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions =================================================================================== */
+
+/* === Public data type declarations =============================================================================== */
+
+/* === Public variable declarations ================================================================================ */
+
+/* === Public function declarations ================================================================================ */
+
+/**
+ * @brief Obtiene una marca de tiempo monotónica del host.
+ *
+ * @return Tiempo actual en nanosegundos.
+ */
+
+uint64_t BenchNow(void);
+
+/**
+ * @brief Imprime un resultado con el costo promedio por iteración.
+ *
+ * @param name Nombre del caso medido.
+ * @param elapsed Tiempo total en nanosegundos.
+ * @param iterations Cantidad de iteraciones ejecutadas.
+ */
+
+void BenchReport(const char * name, uint64_t elapsed, uint64_t iterations);
+
+/* === End of conditional blocks =================================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* BENCH_H_ */
@@ -0,0 +1,263 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Roldan JesusAlejandro <kechuroldanjesus@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+/** @file bench_clock.c
+ ** @brief Micro-benchmark de host para el módulo clock.
+ *
+ * Compara el costo por tick de ClockNewTick contra la implementación anterior, que comparaba los seis bytes
+ * BCD del fin de día en cada tick y propagaba el acarreo dígito por dígito al pasar cada segundo. También mide
+ * cuánto cuesta simular un día completo con ClockAdvanceTicks en lugar de un lazo de ClockNewTick, y compara el
+ * incremento de un segundo en la palabra BCD empaquetada contra la cadena de acarreos byte a byte. Por último
+ * mide el costo por tick con 1, 8 y 64 alarmas habilitadas.
+ *
+ * Compilación y ejecución:
+ *
+ *     gcc -std=c99 -O2 -DCLOCK_MAX_ALARMS=64 -Iinc -Ibench bench/bench_clock.c bench/bench.c src/clock.c \
+ *         -o build/bench_clock
+ *     ./build/bench_clock
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "bench.h"
+#include "clock.h"
+#include <stdio.h>
+#include <string.h>
+
+/* === Macros definitions ========================================================================================== */
+
+#define BENCH_TICKS_PER_SECOND 1000u
+#define BENCH_SECONDS          86400u  // Un día completo, incluye el paso por la medianoche
+
+/* === Private data type declarations ============================================================================== */
+
+/**
+ * @brief Estado del reloj tal como lo mantenía la implementación anterior (BCD byte a byte).
+ */
+
+typedef struct {
+    uint16_t clock_ticks;
+    uint16_t tick_counter;
+    clock_time_t current_time;
+    bool is_valid;
+    bool alarm_active;
+    bool init_mode;
+    bool skippedToday;
+} legacy_clock_t;
+
+/* === Private function declarations =============================================================================== */
+
+static void LegacyNewTick(legacy_clock_t * self);
+
+static void BenchLegacyTick(void);
+
+static void BenchClockNewTick(void);
+
+static void BenchClockAdvanceTicks(void);
+
+static void BenchLegacySecondCarry(void);
+
+static void BenchPackedIncrement(void);
+
+static void BenchAlarmCount(uint8_t alarms);
+
+/* === Private variable definitions ================================================================================ */
+
+static volatile uint8_t sink;
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private function definitions ================================================================================ */
+
+// noinline: ambas versiones pagan el llamado a función, igual que ClockNewTick desde otra unidad de compilación
+__attribute__((noinline)) static void LegacyNewTick(legacy_clock_t * self) {
+    self->tick_counter++;
+    bool end_of_day = false;
+
+    if (self->is_valid && !self->init_mode) {
+        end_of_day = (self->current_time.time.hours[1] == 2 && self->current_time.time.hours[0] == 3 &&
+                      self->current_time.time.minutes[1] == 5 && self->current_time.time.minutes[0] == 9 &&
+                      self->current_time.time.seconds[1] == 5 && self->current_time.time.seconds[0] == 9);
+    }
+
+    if (self->is_valid && !self->init_mode && self->tick_counter >= self->clock_ticks) {
+        self->tick_counter = 0;
+
+        self->current_time.time.seconds[0]++;
+        if (self->current_time.time.seconds[0] == 10) {
+            self->current_time.time.seconds[0] = 0;
+            self->current_time.time.seconds[1]++;
+        }
+        if (self->current_time.time.seconds[1] == 6) {
+            self->current_time.time.seconds[1] = 0;
+            self->current_time.time.minutes[0]++;
+        }
+        if (self->current_time.time.minutes[0] == 10) {
+            self->current_time.time.minutes[0] = 0;
+            self->current_time.time.minutes[1]++;
+        }
+        if (self->current_time.time.minutes[1] == 6) {
+            self->current_time.time.minutes[1] = 0;
+            self->current_time.time.hours[0]++;
+        }
+        if (self->current_time.time.hours[0] == 10) {
+            self->current_time.time.hours[0] = 0;
+            self->current_time.time.hours[1]++;
+        }
+        if (self->current_time.time.hours[1] == 2 && self->current_time.time.hours[0] == 4) {
+            self->current_time.time.hours[0] = 0;
+            self->current_time.time.hours[1] = 0;
+        }
+    }
+
+    if (end_of_day && self->skippedToday) {
+        self->alarm_active = true;
+        self->skippedToday = false;
+    }
+}
+
+static void BenchLegacyTick(void) {
+    legacy_clock_t legacy;
+    memset(&legacy, 0, sizeof(legacy));
+    legacy.clock_ticks = BENCH_TICKS_PER_SECOND;
+    legacy.is_valid = true;
+
+    uint64_t ticks = (uint64_t)BENCH_TICKS_PER_SECOND * BENCH_SECONDS;
+    uint64_t start = BenchNow();
+    for (uint64_t i = 0; i < ticks; i++) {
+        LegacyNewTick(&legacy);
+    }
+    uint64_t elapsed = BenchNow() - start;
+
+    sink = legacy.current_time.bcd[0];
+    BenchReport("NewTick BCD byte a byte (anterior)", elapsed, ticks);
+}
+
+static void BenchClockNewTick(void) {
+    clock_t clock = ClockCreate(BENCH_TICKS_PER_SECOND);
+    clock_time_t now = {0};
+    ClockSetTime(clock, &now);
+
+    uint64_t ticks = (uint64_t)BENCH_TICKS_PER_SECOND * BENCH_SECONDS;
+    uint64_t start = BenchNow();
+    for (uint64_t i = 0; i < ticks; i++) {
+        ClockNewTick(clock);
+    }
+    uint64_t elapsed = BenchNow() - start;
+
+    ClockGetTime(clock, &now);
+    sink = now.bcd[0];
+    BenchReport("ClockNewTick segundos binarios", elapsed, ticks);
+}
+
+static void BenchClockAdvanceTicks(void) {
+    const uint32_t days = 1000;
+    clock_t clock = ClockCreate(BENCH_TICKS_PER_SECOND);
+    clock_time_t now = {0};
+    ClockSetTime(clock, &now);
+
+    uint64_t start = BenchNow();
+    for (uint32_t i = 0; i < days; i++) {
+        ClockAdvanceTicks(clock, BENCH_TICKS_PER_SECOND * BENCH_SECONDS);
+    }
+    uint64_t elapsed = BenchNow() - start;
+
+    ClockGetTime(clock, &now);
+    sink = now.bcd[0];
+    BenchReport("ClockAdvanceTicks (por dia simulado)", elapsed, days);
+}
+
+static void BenchLegacySecondCarry(void) {
+    legacy_clock_t legacy;
+    memset(&legacy, 0, sizeof(legacy));
+    legacy.clock_ticks = 1; // Cada tick es un segundo: se mide solo la cadena de acarreos
+    legacy.is_valid = true;
+
+    uint64_t seconds = 100ull * BENCH_SECONDS;
+    uint64_t start = BenchNow();
+    for (uint64_t i = 0; i < seconds; i++) {
+        LegacyNewTick(&legacy);
+    }
+    uint64_t elapsed = BenchNow() - start;
+
+    sink = legacy.current_time.bcd[0];
+    BenchReport("Segundo BCD byte a byte (anterior)", elapsed, seconds);
+}
+
+static void BenchPackedIncrement(void) {
+    clock_packed_t packed = 0;
+
+    uint64_t seconds = 100ull * BENCH_SECONDS;
+    uint64_t start = BenchNow();
+    for (uint64_t i = 0; i < seconds; i++) {
+        packed = ClockPackedIncrement(packed);
+    }
+    uint64_t elapsed = BenchNow() - start;
+
+    sink = (uint8_t)packed;
+    BenchReport("ClockPackedIncrement SWAR", elapsed, seconds);
+}
+
+static void BenchAlarmCount(uint8_t alarms) {
+    char name[48];
+    clock_t clock = ClockCreate(BENCH_TICKS_PER_SECOND);
+    clock_time_t now = {0};
+    uint32_t fired = 0;
+    ClockSetTime(clock, &now);
+
+    // Alarmas repartidas a lo largo del día, una cada 22 minutos
+    for (uint8_t id = 0; id < alarms && id < CLOCK_MAX_ALARMS; id++) {
+        clock_time_t alarm = {0};
+        uint16_t minutes = 22u * id + 1;
+        alarm.time.minutes[0] = (minutes % 60) % 10;
+        alarm.time.minutes[1] = (minutes % 60) / 10;
+        alarm.time.hours[0] = (minutes / 60) % 10;
+        alarm.time.hours[1] = (minutes / 60) / 10;
+        ClockSetAlarmById(clock, id, &alarm);
+        ClockEnableAlarmById(clock, id);
+    }
+
+    uint64_t ticks = (uint64_t)BENCH_TICKS_PER_SECOND * BENCH_SECONDS;
+    uint64_t start = BenchNow();
+    for (uint64_t i = 0; i < ticks; i++) {
+        fired += ClockNewTick(clock);
+    }
+    uint64_t elapsed = BenchNow() - start;
+
+    sink = (uint8_t)fired;
+    snprintf(name, sizeof(name), "ClockNewTick con %u alarmas (%u disparos)", alarms, (unsigned)fired);
+    BenchReport(name, elapsed, ticks);
+    ClockDestroy(clock);
+}
+
+/* === Public function implementation ============================================================================== */
+
+int main(void) {
+    BenchLegacyTick();
+    BenchClockNewTick();
+    BenchClockAdvanceTicks();
+    BenchLegacySecondCarry();
+    BenchPackedIncrement();
+    BenchAlarmCount(1);
+    BenchAlarmCount(8);
+    BenchAlarmCount(64);
+    return 0;
+}
+
+/* === End of documentation ======================================================================================== */
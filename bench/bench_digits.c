@@ -0,0 +1,177 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Roldan JesusAlejandro <kechuroldanjesus@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+/** @file bench_digits.c
+ ** @brief Micro-benchmark de host del multiplexado de pantallas de cuatro, seis y ocho dígitos.
+ *
+ * Simula una hora de pantalla a SCREEN_FRAME_RATE_HZ imágenes por segundo con cada cantidad de dígitos: HH:MM en
+ * cuatro, HH:MM:SS en seis y HH MM SS en ocho, con el punto central parpadeando. Cada segundo escribe la hora con
+ * ScreenWriteLayout y entre segundos refresca la pantalla con un controlador WriteDigitFrame que no hace nada.
+ *
+ * Informa el costo de cada refresco, que no debería depender de la cantidad de dígitos, el tiempo encendido de cada
+ * dígito que da ScreenOnTime y el tiempo de procesador que consume la pantalla por segundo, que crece con los
+ * refrescos por segundo.
+ *
+ * Repite la simulación con controladores serie tipo MAX7219 (max7219.c) sobre un bus que solo cuenta los flancos:
+ * una llamada a ScreenRefresh por imagen que no envía nada si la imagen no cambió, así que el costo casi no depende
+ * de la cantidad de dígitos.
+ *
+ * Compilación y ejecución:
+ *
+ *     gcc -std=c99 -O2 -Iinc -Ibench bench/bench_digits.c bench/bench.c src/screen.c src/max7219.c \
+ *         -o build/bench_digits
+ *     ./build/bench_digits
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "bench.h"
+#include "screen.h"
+#include "max7219.h"
+#include <stdio.h>
+
+/* === Macros definitions ========================================================================================== */
+
+#define BENCH_SECONDS 3600u // Segundos simulados con cada cantidad de dígitos
+
+/* === Private data type declarations ============================================================================== */
+
+/* === Private function declarations =============================================================================== */
+
+static void NullWriteDigitFrame(const screen_digit_frame_t * frame);
+
+static void TimeAt(uint32_t seconds, clock_time_t * time);
+
+static void BenchDigits(uint8_t digits, const screen_layout_t * layout);
+
+static void NullLine(bool high);
+
+static void BenchSerial(uint8_t chips, uint8_t digits_per_chip, const screen_layout_t * layout);
+
+/* === Private variable definitions ================================================================================ */
+
+static const uint32_t bench_digit_words[SCREEN_MAX_DIGITS] = {0x80, 0x40, 0x20, 0x10, 0x08, 0x04, 0x02, 0x01};
+
+static const struct screen_driver_s bench_driver = {
+    .WriteDigitFrame = NullWriteDigitFrame,
+    .digit_words = bench_digit_words,
+    .point_word = 1u << 16,
+};
+
+static const struct max7219_bus_s bench_bus = {
+    .Data = NullLine,
+    .Clock = NullLine,
+    .Load = NullLine,
+};
+
+static uint32_t sink; // Evita que se descarten las palabras recibidas
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private function definitions ================================================================================ */
+
+static void NullWriteDigitFrame(const screen_digit_frame_t * frame) {
+    sink += frame->segments ^ frame->point ^ frame->digit;
+}
+
+static void TimeAt(uint32_t seconds, clock_time_t * time) {
+    uint32_t minutes = (seconds / 60u) % 60u;
+    uint32_t hours = (12u + seconds / 3600u) % 24u;
+
+    time->time.seconds[0] = seconds % 10u;
+    time->time.seconds[1] = (seconds % 60u) / 10u;
+    time->time.minutes[0] = minutes % 10u;
+    time->time.minutes[1] = minutes / 10u;
+    time->time.hours[0] = hours % 10u;
+    time->time.hours[1] = hours / 10u;
+}
+
+static void BenchDigits(uint8_t digits, const screen_layout_t * layout) {
+    ScreenT screen = ScreenCreate(digits, &bench_driver);
+    uint32_t refreshes = (uint32_t)SCREEN_FRAME_RATE_HZ * digits; // Refrescos por segundo
+    uint8_t middle = (uint8_t)(1u << (layout->size / 2 - 1));
+    uint64_t write_elapsed = 0;
+    uint64_t refresh_elapsed = 0;
+    clock_time_t time;
+    char name[48];
+
+    for (uint32_t second = 0; second < BENCH_SECONDS; second++) {
+        TimeAt(second, &time);
+
+        uint64_t start = BenchNow();
+        ScreenWriteLayout(screen, layout, time.bcd, (second & 1) ? middle : 0);
+        uint64_t written = BenchNow();
+        for (uint32_t slot = 0; slot < refreshes; slot++) {
+            ScreenRefresh(screen);
+        }
+        refresh_elapsed += BenchNow() - written;
+        write_elapsed += written - start;
+    }
+
+    snprintf(name, sizeof(name), "%u dígitos: ScreenWriteLayout", digits);
+    BenchReport(name, write_elapsed, BENCH_SECONDS);
+    snprintf(name, sizeof(name), "%u dígitos: ScreenRefresh", digits);
+    BenchReport(name, refresh_elapsed, (uint64_t)BENCH_SECONDS * refreshes);
+    printf("    %u refrescos por segundo, %u us encendido cada dígito, %.1f us de procesador por segundo\n",
+           refreshes, ScreenOnTime(screen, SCREEN_FRAME_RATE_HZ),
+           (double)(refresh_elapsed + write_elapsed) / BENCH_SECONDS / 1000.0);
+}
+
+static void NullLine(bool high) {
+    sink += high;
+}
+
+static void BenchSerial(uint8_t chips, uint8_t digits_per_chip, const screen_layout_t * layout) {
+    uint8_t digits = chips * digits_per_chip;
+    ScreenT screen = ScreenCreate(digits, Max7219Create(&bench_bus, chips, digits_per_chip));
+    uint8_t middle = (uint8_t)(1u << (layout->size / 2 - 1));
+    uint32_t bits = Max7219Stats()->bits; // Sin contar la configuración
+    clock_time_t time;
+    char name[48];
+
+    uint64_t start = BenchNow();
+    for (uint32_t second = 0; second < BENCH_SECONDS; second++) {
+        TimeAt(second, &time);
+        ScreenWriteLayout(screen, layout, time.bcd, (second & 1) ? middle : 0);
+        for (uint32_t frame = 0; frame < SCREEN_FRAME_RATE_HZ; frame++) {
+            ScreenRefresh(screen);
+        }
+    }
+    uint64_t elapsed = BenchNow() - start;
+
+    snprintf(name, sizeof(name), "%u dígitos en %u MAX7219: ScreenRefresh", digits, chips);
+    BenchReport(name, elapsed, (uint64_t)BENCH_SECONDS * SCREEN_FRAME_RATE_HZ);
+    printf("    %u refrescos por segundo, %.1f bits enviados por segundo, %.1f us de procesador por segundo\n",
+           SCREEN_FRAME_RATE_HZ, (double)(Max7219Stats()->bits - bits) / BENCH_SECONDS,
+           (double)elapsed / BENCH_SECONDS / 1000.0);
+}
+
+/* === Public function implementation ============================================================================== */
+
+int main(void) {
+    BenchDigits(4, &SCREEN_LAYOUT_HHMM);
+    BenchDigits(6, &SCREEN_LAYOUT_HHMMSS);
+    BenchDigits(8, &SCREEN_LAYOUT_HH_MM_SS);
+    BenchSerial(1, 4, &SCREEN_LAYOUT_HHMM);
+    BenchSerial(1, 6, &SCREEN_LAYOUT_HHMMSS);
+    BenchSerial(2, 4, &SCREEN_LAYOUT_HH_MM_SS);
+    return sink == 0;
+}
+
+/* === End of documentation ======================================================================================== */
@@ -0,0 +1,218 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Roldan JesusAlejandro <kechuroldanjesus@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+/** @file bench_events.c
+ ** @brief Micro-benchmark de host de la cola de eventos de los botones ante una tormenta de pulsaciones.
+ *
+ * Modela la cola xEvtQ (10 lugares, envío sin espera) entre la tarea de botones y la máquina de estados. En cada
+ * muestreo de 5 ms la tarea de botones genera una ráfaga de pasos de aumentar o disminuir y la máquina de estados
+ * alcanza a atender solo algunos mensajes. Se compara la forma anterior, un mensaje por paso aplicado con
+ * UpBCDAdjusted/DownBCDAdjusted, contra la actual, que suma los pasos en un único EV_ADJUST y lo aplica con
+ * ClockBcdAdjust. Para cada una informa los pasos perdidos, los mensajes atendidos y el tiempo por paso.
+ *
+ * Compilación y ejecución:
+ *
+ *     gcc -std=c99 -O2 -Iinc -Ibench bench/bench_events.c bench/bench.c src/clock.c -o build/bench_events
+ *     ./build/bench_events
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "bench.h"
+#include "clock.h"
+#include <stdio.h>
+
+/* === Macros definitions ========================================================================================== */
+
+#define BENCH_QUEUE_LENGTH   10u      // Igual que xEvtQ en main.c
+#define BENCH_SCANS          2000000u // Muestreos de la tarea de botones simulados
+#define BENCH_BURST_MAX      24u      // Pasos máximos generados en un muestreo
+#define BENCH_FSM_PER_SCAN   2u       // Mensajes que la máquina de estados atiende en cada muestreo
+
+/* === Private data type declarations ============================================================================== */
+
+/**
+ * @brief Cola de mensajes de tamaño fijo, como una cola de FreeRTOS enviada sin espera.
+ */
+
+typedef struct {
+    int16_t items[BENCH_QUEUE_LENGTH];
+    uint8_t head;
+    uint8_t count;
+} bench_queue_t;
+
+/**
+ * @brief Resultado de una corrida.
+ */
+
+typedef struct {
+    uint64_t steps;    //!< Pasos generados por las teclas
+    uint64_t dropped;  //!< Pasos perdidos por encontrar la cola llena
+    uint64_t messages; //!< Mensajes atendidos por la máquina de estados
+    uint8_t minutes;   //!< Valor final del campo ajustado
+    uint8_t expected;  //!< Valor que debería tener si no se perdiera ningún paso
+} bench_result_t;
+
+/* === Private function declarations =============================================================================== */
+
+static bool QueueSend(bench_queue_t * queue, int16_t item);
+
+static bool QueueReceive(bench_queue_t * queue, int16_t * item);
+
+static int16_t StormStep(uint32_t * seed);
+
+static void LegacyUp(uint8_t numero[2]);
+
+static void LegacyDown(uint8_t numero[2]);
+
+static void FsmLegacy(uint8_t minutes[2], int16_t item);
+
+static void FsmAdjust(uint8_t minutes[2], int16_t item);
+
+static void BenchStorm(bool coalesce);
+
+/* === Private variable definitions ================================================================================ */
+
+static volatile uint8_t sink;
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private function definitions ================================================================================ */
+
+static bool QueueSend(bench_queue_t * queue, int16_t item) {
+    if (queue->count == BENCH_QUEUE_LENGTH) {
+        return false;
+    }
+    queue->items[(queue->head + queue->count) % BENCH_QUEUE_LENGTH] = item;
+    queue->count++;
+    return true;
+}
+
+static bool QueueReceive(bench_queue_t * queue, int16_t * item) {
+    if (queue->count == 0) {
+        return false;
+    }
+    *item = queue->items[queue->head];
+    queue->head = (queue->head + 1) % BENCH_QUEUE_LENGTH;
+    queue->count--;
+    return true;
+}
+
+// Generador congruencial: la misma tormenta para las dos corridas, con rachas largas de un mismo sentido
+static int16_t StormStep(uint32_t * seed) {
+    *seed = *seed * 1664525u + 1013904223u;
+    return (*seed >> 28) < 12 ? 1 : -1;
+}
+
+// Copias de las funciones que main.c usaba antes de ClockBcdAdjust, solo para minutos
+__attribute__((noinline)) static void LegacyUp(uint8_t numero[2]) {
+    uint16_t value = numero[1] * 10 + numero[0];
+    value = (value + 1) % 60;
+    numero[1] = value / 10;
+    numero[0] = value % 10;
+}
+
+__attribute__((noinline)) static void LegacyDown(uint8_t numero[2]) {
+    uint16_t value = numero[1] * 10 + numero[0];
+    value = (value == 0) ? 59 : value - 1;
+    numero[1] = value / 10;
+    numero[0] = value % 10;
+}
+
+// noinline: cada mensaje paga una pasada de la máquina de estados
+__attribute__((noinline)) static void FsmLegacy(uint8_t minutes[2], int16_t item) {
+    if (item > 0) {
+        LegacyUp(minutes);
+    } else {
+        LegacyDown(minutes);
+    }
+}
+
+__attribute__((noinline)) static void FsmAdjust(uint8_t minutes[2], int16_t item) {
+    ClockBcdAdjust(minutes, item, 60);
+}
+
+static void BenchStorm(bool coalesce) {
+    bench_queue_t queue = {0};
+    bench_result_t result = {0};
+    uint8_t minutes[2] = {0, 0};
+    uint32_t seed = 12345;
+    int32_t total = 0;
+    int16_t pending = 0;
+    int16_t item;
+    char name[64];
+
+    uint64_t start = BenchNow();
+    for (uint32_t scan = 0; scan < BENCH_SCANS; scan++) {
+        uint32_t burst = scan % (BENCH_BURST_MAX + 1);
+
+        for (uint32_t step = 0; step < burst; step++) {
+            int16_t delta = StormStep(&seed);
+            total += delta;
+            result.steps++;
+            if (coalesce) {
+                pending += delta;
+            } else if (!QueueSend(&queue, delta)) {
+                result.dropped++;
+            }
+        }
+        // Si la cola está llena los pasos acumulados esperan al próximo muestreo
+        if (coalesce && pending != 0 && QueueSend(&queue, pending)) {
+            pending = 0;
+        }
+
+        for (uint32_t pass = 0; pass < BENCH_FSM_PER_SCAN && QueueReceive(&queue, &item); pass++) {
+            if (coalesce) {
+                FsmAdjust(minutes, item);
+            } else {
+                FsmLegacy(minutes, item);
+            }
+            result.messages++;
+        }
+    }
+    while (QueueReceive(&queue, &item)) {
+        coalesce ? FsmAdjust(minutes, item) : FsmLegacy(minutes, item);
+        result.messages++;
+    }
+    if (coalesce && pending != 0) {
+        FsmAdjust(minutes, pending);
+        result.messages++;
+    }
+    uint64_t elapsed = BenchNow() - start;
+
+    result.minutes = minutes[1] * 10 + minutes[0];
+    result.expected = (uint8_t)(((total % 60) + 60) % 60);
+    sink = result.minutes;
+
+    snprintf(name, sizeof(name), "%s", coalesce ? "EV_ADJUST acumulado" : "Un evento por paso (anterior)");
+    BenchReport(name, elapsed, result.steps);
+    printf("    pasos %llu, perdidos %llu, mensajes %llu, minutos %02u (esperado %02u)\n",
+           (unsigned long long)result.steps, (unsigned long long)result.dropped,
+           (unsigned long long)result.messages, result.minutes, result.expected);
+}
+
+/* === Public function implementation ============================================================================== */
+
+int main(void) {
+    BenchStorm(false);
+    BenchStorm(true);
+    return 0;
+}
+
+/* === End of documentation ======================================================================================== */
@@ -0,0 +1,160 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Roldan JesusAlejandro <kechuroldanjesus@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+/** @file bench_fsm.c
+ ** @brief Micro-benchmark de host de la máquina de estados de la interfaz (FsmDispatch).
+ *
+ * Mide los eventos por segundo que atiende la máquina de estados con un controlador que no hace nada, en tres
+ * mezclas: una sesión de puesta en hora completa, la verificación de la alarma en el estado normal y eventos al azar
+ * sobre todas las celdas de la tabla de transiciones.
+ *
+ * Compilación y ejecución:
+ *
+ *     gcc -std=c99 -O2 -Iinc -Ibench bench/bench_fsm.c bench/bench.c src/clock.c src/fsm.c -o build/bench_fsm
+ *     ./build/bench_fsm
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "bench.h"
+#include "fsm.h"
+#include <stdio.h>
+
+/* === Macros definitions ========================================================================================== */
+
+#define BENCH_EVENTS 20000000u // Eventos entregados en cada mezcla
+
+/* === Private data type declarations ============================================================================== */
+
+/* === Private function declarations =============================================================================== */
+
+static void NullFlash(uint8_t from, uint8_t to, uint16_t divisor);
+
+static void NullAlarmOutput(bool on);
+
+static void BenchReportRate(const char * name, uint64_t elapsed, uint64_t events);
+
+static void BenchSetTimeSession(clock_t clock);
+
+static void BenchAlarmCheck(clock_t clock);
+
+static void BenchRandom(clock_t clock);
+
+/* === Private variable definitions ================================================================================ */
+
+static const struct fsm_driver_s null_driver = {
+    .FlashDigits = NullFlash,
+    .FlashPoints = NullFlash,
+    .AlarmOutput = NullAlarmOutput,
+};
+
+static volatile uint32_t sink;
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private function definitions ================================================================================ */
+
+static void NullFlash(uint8_t from, uint8_t to, uint16_t divisor) {
+    sink += from + to + divisor;
+}
+
+static void NullAlarmOutput(bool on) {
+    sink += on;
+}
+
+static void BenchReportRate(const char * name, uint64_t elapsed, uint64_t events) {
+    BenchReport(name, elapsed, events);
+    printf("    %.2f millones de eventos por segundo\n", elapsed ? (double)events * 1e3 / (double)elapsed : 0.0);
+}
+
+// Entrar a poner la hora, ajustar minutos y horas y aceptar: 8 eventos por sesión
+static void BenchSetTimeSession(clock_t clock) {
+    static const app_event_t session[] = {
+        {.type = EV_SET_TIME}, {.type = EV_ADJUST, .delta = 7}, {.type = EV_ADJUST, .delta = -2},
+        {.type = EV_ACCEPT},   {.type = EV_ADJUST, .delta = 5}, {.type = EV_CLEAR},
+        {.type = EV_ADJUST, .delta = 13}, {.type = EV_ACCEPT},
+    };
+    const uint32_t length = sizeof(session) / sizeof(session[0]);
+    fsm_t fsm;
+
+    FsmInit(&fsm, clock, &null_driver);
+    uint64_t start = BenchNow();
+    for (uint32_t event = 0; event < BENCH_EVENTS; event++) {
+        FsmDispatch(&fsm, &session[event % length]);
+    }
+    uint64_t elapsed = BenchNow() - start;
+    sink += fsm.state;
+    BenchReportRate("Sesión de puesta en hora", elapsed, BENCH_EVENTS);
+}
+
+// Estado normal con la alarma habilitada: cada aviso de la base de tiempo compara la alarma con la hora
+static void BenchAlarmCheck(clock_t clock) {
+    const app_event_t check = {.type = EV_ALARM};
+    fsm_t fsm;
+
+    FsmInit(&fsm, clock, &null_driver);
+    FsmDispatch(&fsm, &(app_event_t){.type = EV_SET_TIME});
+    FsmDispatch(&fsm, &(app_event_t){.type = EV_ACCEPT});
+    FsmDispatch(&fsm, &(app_event_t){.type = EV_ACCEPT});
+    FsmDispatch(&fsm, &(app_event_t){.type = EV_ACCEPT});
+
+    uint64_t start = BenchNow();
+    for (uint32_t event = 0; event < BENCH_EVENTS; event++) {
+        FsmDispatch(&fsm, &check);
+    }
+    uint64_t elapsed = BenchNow() - start;
+    sink += fsm.alarm_triggered;
+    BenchReportRate("Verificación de alarma", elapsed, BENCH_EVENTS);
+}
+
+// Eventos al azar: recorre todas las celdas de la tabla, incluidas las que se ignoran
+static void BenchRandom(clock_t clock) {
+    static app_event_t events[1024];
+    uint32_t seed = 12345;
+    fsm_t fsm;
+
+    for (uint32_t index = 0; index < sizeof(events) / sizeof(events[0]); index++) {
+        seed = seed * 1664525u + 1013904223u;
+        events[index].type = (event_t)((seed >> 24) % EV_COUNT);
+        events[index].delta = (int16_t)((seed >> 8) % 21) - 10;
+    }
+
+    FsmInit(&fsm, clock, &null_driver);
+    uint64_t start = BenchNow();
+    for (uint32_t event = 0; event < BENCH_EVENTS; event++) {
+        FsmDispatch(&fsm, &events[event % 1024u]);
+    }
+    uint64_t elapsed = BenchNow() - start;
+    sink += fsm.state;
+    BenchReportRate("Eventos al azar", elapsed, BENCH_EVENTS);
+}
+
+/* === Public function implementation ============================================================================== */
+
+int main(void) {
+    clock_t clock = ClockCreate(100);
+
+    BenchSetTimeSession(clock);
+    BenchAlarmCheck(clock);
+    BenchRandom(clock);
+    ClockDestroy(clock);
+    return 0;
+}
+
+/* === End of documentation ======================================================================================== */
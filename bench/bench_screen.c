@@ -0,0 +1,346 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Roldan JesusAlejandro <kechuroldanjesus@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+/** @file bench_screen.c
+ ** @brief Micro-benchmark de host de la composición de la pantalla durante una hora simulada.
+ *
+ * Simula una hora de multiplexado a un dígito cada 3 ms con un controlador que registra todo lo que se escribe en
+ * la pantalla. Compara tres formas de componer HH:MM con el punto central parpadeando cada segundo:
+ *
+ * - Anterior: el ScreenWriteBCD y el ScreenRefresh originales (cd0df0c), copiados aquí con su propio estado, que
+ *   borran la imagen y codifican los cuatro dígitos en cada llamada.
+ * - ScreenWriteBCD en cada refresco: con el seguimiento de cambios casi todas las llamadas no hacen nada.
+ * - ScreenWriteBCD en cada cambio de segundo, como la máquina de estados en main.c.
+ *
+ * Llamado en cada refresco, el seguimiento de cambios no es más barato que el original: comparar la hora con la
+ * última escrita cuesta más que borrar y codificar cuatro dígitos. La ganancia está en llamar a ScreenWriteBCD solo
+ * cuando cambia el segundo, que con la imagen doble ya no hace falta repetir en cada refresco.
+ *
+ * Cada forma corre dos veces: la primera mide solo el tiempo de composición y la segunda refresca la pantalla
+ * después de cada composición, sin medir el tiempo, para obtener una suma de verificación de lo que recibió el
+ * controlador, que debe ser la misma en las tres. Informa además los dígitos y puntos codificados.
+ *
+ * Después compara el costo de ScreenRefresh con las tres llamadas DigitsTurnOff, SegmentsUpdate y DigitsTurnOn
+ * contra una sola llamada a WriteDigitFrame con las palabras calculadas al publicar la imagen. Los controladores
+ * cuentan las llamadas y las escrituras a registros que hace bsp.c en cada caso, y cuántas de ellas quedan entre
+ * apagar un dígito y encender el siguiente. Cada controlador se mide sin parpadeo y con dos grupos parpadeando, para
+ * ver que aplicar las máscaras de visibilidad no agrega costo al refresco.
+ *
+ * Compilación y ejecución:
+ *
+ *     gcc -std=c99 -O2 -Iinc -Ibench bench/bench_screen.c bench/bench.c src/screen.c -o build/bench_screen
+ *     ./build/bench_screen
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "bench.h"
+#include "screen.h"
+#include <stdio.h>
+#include <string.h>
+
+/* === Macros definitions ========================================================================================== */
+
+#define BENCH_REFRESH_MS 3u                         // Tiempo que queda encendido cada dígito
+#define BENCH_SLOTS      (3600000u / BENCH_REFRESH_MS) // Refrescos en una hora
+#define BENCH_DIGITS     4u
+
+/* === Private data type declarations ============================================================================== */
+
+typedef enum {
+    BENCH_LEGACY,       //!< Codificar todo en cada refresco
+    BENCH_EVERY_SLOT,   //!< ScreenWriteBCD en cada refresco
+    BENCH_EVERY_SECOND, //!< ScreenWriteBCD en cada cambio de segundo
+} bench_mode_t;
+
+/**
+ * @brief Lo que registra el controlador de prueba.
+ */
+
+/**
+ * @brief Estado de la pantalla original que usan BaselineWriteBCD y BaselineRefresh.
+ */
+
+typedef struct {
+    uint8_t digits;                                  //!< Cantidad de dígitos de la pantalla
+    uint8_t current_digit;                           //!< Dígito encendido
+    screen_driver_t driver;                          //!< Controlador de la pantalla
+    uint8_t value[SCREEN_MAX_DIGITS];                //!< Segmentos de cada dígito
+    uint8_t value_decimal_points[SCREEN_MAX_DIGITS]; //!< Punto decimal de cada dígito
+} baseline_screen_t;
+
+typedef struct {
+    uint64_t checksum;   //!< Suma de verificación de los dígitos encendidos
+    uint32_t turn_on;    //!< Dígitos encendidos
+    uint8_t segments;    //!< Segmentos escritos antes de encender el dígito
+    uint8_t points;      //!< Punto escrito antes de encender el dígito
+} bench_recorder_t;
+
+/* === Private function declarations =============================================================================== */
+
+static void RecorderDigitsTurnOff(void);
+
+static void RecorderSegmentsUpdate(uint8_t segments, uint8_t points);
+
+static void RecorderDigitsTurnOn(uint8_t digit);
+
+static void TimeAt(uint32_t seconds, clock_time_t * time);
+
+static void BaselineWriteBCD(baseline_screen_t * self, const clock_time_t * time, bool show_seconds,
+                             uint8_t decimal_points[]);
+
+static void BaselineRefresh(baseline_screen_t * screen);
+
+static uint64_t BenchPass(bench_mode_t mode, ScreenT screen, bool refresh);
+
+static void BenchHour(bench_mode_t mode);
+
+static void CounterDigitsTurnOff(void);
+
+static void CounterSegmentsUpdate(uint8_t segments, uint8_t points);
+
+static void CounterDigitsTurnOn(uint8_t digit);
+
+static void CounterWriteDigitFrame(const screen_digit_frame_t * frame);
+
+static void BenchRefresh(screen_driver_t driver, bool blink, const char * name);
+
+/* === Private variable definitions ================================================================================ */
+
+static bench_recorder_t recorder;
+
+/**
+ * @brief Lo que cuentan los controladores de la comparación de ScreenRefresh.
+ */
+
+static struct {
+    uint64_t calls;   //!< Llamadas al controlador
+    uint64_t writes;  //!< Escrituras a registros GPIO que hace bsp.c
+    uint64_t dark;    //!< Escrituras entre apagar un dígito y encender el siguiente
+    uint32_t sink;    //!< Evita que se descarten los valores recibidos
+} counter;
+
+static const struct screen_driver_s counter_driver = {
+    .DigitsTurnOff = CounterDigitsTurnOff,
+    .SegmentsUpdate = CounterSegmentsUpdate,
+    .DigitsTurnOn = CounterDigitsTurnOn,
+};
+
+static const uint32_t counter_digit_words[BENCH_DIGITS] = {0x08, 0x04, 0x02, 0x01};
+
+static const struct screen_driver_s counter_frame_driver = {
+    .WriteDigitFrame = CounterWriteDigitFrame,
+    .digit_words = counter_digit_words,
+    .point_word = 1u << 16,
+};
+
+static const struct screen_driver_s recorder_driver = {
+    .DigitsTurnOff = RecorderDigitsTurnOff,
+    .SegmentsUpdate = RecorderSegmentsUpdate,
+    .DigitsTurnOn = RecorderDigitsTurnOn,
+};
+
+// Copia de IMAGES en screen.c, para la forma anterior
+static const uint8_t BASELINE_IMAGES[10] = {0x3F, 0x06, 0x5B, 0x4F, 0x66, 0x6D, 0x7D, 0x07, 0x7F, 0x6F};
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private function definitions ================================================================================ */
+
+static void RecorderDigitsTurnOff(void) {
+}
+
+static void RecorderSegmentsUpdate(uint8_t segments, uint8_t points) {
+    recorder.segments = segments;
+    recorder.points = points;
+}
+
+static void RecorderDigitsTurnOn(uint8_t digit) {
+    recorder.checksum = recorder.checksum * 31u + ((uint32_t)digit << 16 | recorder.points << 8 | recorder.segments);
+    recorder.turn_on++;
+}
+
+static void TimeAt(uint32_t seconds, clock_time_t * time) {
+    uint32_t minutes = (seconds / 60u) % 60u;
+    uint32_t hours = (12u + seconds / 3600u) % 24u;
+
+    time->time.seconds[0] = seconds % 10u;
+    time->time.seconds[1] = (seconds % 60u) / 10u;
+    time->time.minutes[0] = minutes % 10u;
+    time->time.minutes[1] = minutes / 10u;
+    time->time.hours[0] = hours % 10u;
+    time->time.hours[1] = hours / 10u;
+}
+
+// ScreenWriteBCD de cd0df0c, sin cambios salvo el tipo de la pantalla
+__attribute__((noinline)) static void BaselineWriteBCD(baseline_screen_t * self, const clock_time_t * time,
+                                                       bool show_seconds, uint8_t decimal_points[]) {
+    memset(self->value, 0, sizeof(self->value));
+    memset(self->value_decimal_points, 0, sizeof(self->value_decimal_points));
+
+    uint8_t digits[4];
+
+    if (show_seconds) {
+        digits[0] = time->time.minutes[1];
+        digits[1] = time->time.minutes[0];
+        digits[2] = time->time.seconds[1];
+        digits[3] = time->time.seconds[0];
+    } else {
+        digits[0] = time->time.hours[1];
+        digits[1] = time->time.hours[0];
+        digits[2] = time->time.minutes[1];
+        digits[3] = time->time.minutes[0];
+    }
+
+    for (uint8_t i = 0; i < 4; i++) {
+        if (digits[i] <= 9) {
+            self->value[i] = BASELINE_IMAGES[digits[i]];
+        } else {
+            self->value[i] = 0;
+        }
+        self->value_decimal_points[i] = decimal_points[i] ? SEGMENT_P : 0;
+    }
+}
+
+// ScreenRefresh de cd0df0c sin parpadeo configurado, solo para la suma de verificación
+static void BaselineRefresh(baseline_screen_t * screen) {
+    screen->driver->DigitsTurnOff();
+    screen->current_digit = (screen->current_digit + 1) % screen->digits;
+    screen->driver->SegmentsUpdate(screen->value[screen->current_digit],
+                                   screen->value_decimal_points[screen->current_digit]);
+    screen->driver->DigitsTurnOn(screen->current_digit);
+}
+
+// Una hora de refrescos; devuelve los dígitos y puntos codificados
+static uint64_t BenchPass(bench_mode_t mode, ScreenT screen, bool refresh) {
+    uint64_t encoded = 0;
+    uint32_t last_second = UINT32_MAX;
+    clock_time_t time = {0};
+    uint8_t points[4] = {0, 0, 0, 0};
+    baseline_screen_t baseline = {.digits = BENCH_DIGITS, .driver = &recorder_driver};
+
+    for (uint32_t slot = 0; slot < BENCH_SLOTS; slot++) {
+        uint32_t second = slot * BENCH_REFRESH_MS / 1000u;
+        bool new_second = (second != last_second);
+
+        if (new_second) {
+            TimeAt(second, &time);
+            points[1] = second & 1u;
+            last_second = second;
+        }
+        if (mode == BENCH_LEGACY) {
+            BaselineWriteBCD(&baseline, &time, false, points);
+            encoded += 2 * BENCH_DIGITS;
+        } else if (mode == BENCH_EVERY_SLOT || new_second) {
+            encoded += ScreenWriteBCD(screen, &time, false, points);
+        }
+        if (refresh) {
+            if (mode == BENCH_LEGACY) {
+                BaselineRefresh(&baseline);
+            } else {
+                ScreenRefresh(screen);
+            }
+        }
+    }
+    return encoded;
+}
+
+static void BenchHour(bench_mode_t mode) {
+    static const char * const names[] = {"Codificar en cada refresco (anterior)", "ScreenWriteBCD en cada refresco",
+                                         "ScreenWriteBCD en cada segundo"};
+
+    uint64_t start = BenchNow();
+    uint64_t encoded = BenchPass(mode, ScreenCreate(BENCH_DIGITS, &recorder_driver), false);
+    uint64_t elapsed = BenchNow() - start;
+
+    recorder = (bench_recorder_t){0};
+    BenchPass(mode, ScreenCreate(BENCH_DIGITS, &recorder_driver), true);
+
+    BenchReport(names[mode], elapsed, BENCH_SLOTS);
+    printf("    dígitos y puntos codificados %llu, dígitos encendidos %u, verificación %016llx\n",
+           (unsigned long long)encoded, recorder.turn_on, (unsigned long long)recorder.checksum);
+}
+
+// DigitsTurnOff en bsp.c: apaga dígitos, segmentos y punto
+static void CounterDigitsTurnOff(void) {
+    counter.calls++;
+    counter.writes += 3;
+    counter.dark += 2;
+}
+
+// SegmentsUpdate en bsp.c: segmentos y punto
+static void CounterSegmentsUpdate(uint8_t segments, uint8_t points) {
+    counter.calls++;
+    counter.writes += 2;
+    counter.dark += 2;
+    counter.sink += segments ^ points;
+}
+
+static void CounterDigitsTurnOn(uint8_t digit) {
+    counter.calls++;
+    counter.writes += 1;
+    counter.sink += digit;
+}
+
+// WriteDigitFrame en bsp.c: apagar dígitos, segmentos, punto y encender el dígito, con escrituras enmascaradas
+static void CounterWriteDigitFrame(const screen_digit_frame_t * frame) {
+    counter.calls++;
+    counter.writes += 4;
+    counter.dark += 2;
+    counter.sink += frame->segments ^ frame->point ^ frame->digit;
+}
+
+static void BenchRefresh(screen_driver_t driver, bool blink, const char * name) {
+    ScreenT screen = ScreenCreate(BENCH_DIGITS, driver);
+    clock_time_t time;
+
+    TimeAt(1234, &time);
+    ScreenWriteBCD(screen, &time, false, (uint8_t[]){0, 1, 0, 1});
+    if (blink) {
+        DisplayFlashDigits(screen, 0, 1, 50);
+        ScreenBlink(screen, 2, 0, 1u << 3, 20, 0);
+    }
+    counter.calls = counter.writes = counter.dark = 0;
+
+    uint64_t start = BenchNow();
+    for (uint32_t slot = 0; slot < BENCH_SLOTS; slot++) {
+        ScreenRefresh(screen);
+    }
+    uint64_t elapsed = BenchNow() - start;
+
+    BenchReport(name, elapsed, BENCH_SLOTS);
+    printf("    por refresco: %.1f llamadas, %.1f escrituras, %.1f con la pantalla apagada\n",
+           (double)counter.calls / BENCH_SLOTS, (double)counter.writes / BENCH_SLOTS,
+           (double)counter.dark / BENCH_SLOTS);
+}
+
+/* === Public function implementation ============================================================================== */
+
+int main(void) {
+    BenchHour(BENCH_LEGACY);
+    BenchHour(BENCH_EVERY_SLOT);
+    BenchHour(BENCH_EVERY_SECOND);
+    BenchRefresh(&counter_driver, false, "ScreenRefresh con tres llamadas");
+    BenchRefresh(&counter_driver, true, "ScreenRefresh con tres llamadas y parpadeo");
+    BenchRefresh(&counter_frame_driver, false, "ScreenRefresh con WriteDigitFrame");
+    BenchRefresh(&counter_frame_driver, true, "ScreenRefresh con WriteDigitFrame y parpadeo");
+    return 0;
+}
+
+/* === End of documentation ======================================================================================== */
@@ -46,10 +46,17 @@ SPDX-License-Identifier: MIT
 
 #define configUSE_PREEMPTION             1
 #define configUSE_IDLE_HOOK              0
-#define configUSE_TICKLESS_IDLE          0
-#define configUSE_TICK_HOOK              0
+#define configUSE_TICKLESS_IDLE          1
 #define configCPU_CLOCK_HZ               (SystemCoreClock)
+/* The clock timebase is chosen with BOARD_TIMEBASE_TICK_HOOK: the tick hook backend needs a 1 ms kernel tick to
+ * drive the clock, while the TIMER1 backend leaves the kernel tick free to drop to 100 Hz with no tick hook. */
+#ifdef BOARD_TIMEBASE_TICK_HOOK
+#define configUSE_TICK_HOOK              1
 #define configTICK_RATE_HZ               ((TickType_t)1000) // 1000 ticks per second => 1ms tick rate
+#else
+#define configUSE_TICK_HOOK              0
+#define configTICK_RATE_HZ               ((TickType_t)100)  // 100 ticks per second => 10ms tick rate
+#endif
 #define configMAX_PRIORITIES             (15)
 #define configMINIMAL_STACK_SIZE         ((uint16_t)128)
 #define configAPPLICATION_ALLOCATED_HEAP 0
@@ -161,6 +168,25 @@ void vMainPostStopProcessing(void);
 #define configPRE_STOP_PROCESSING  vMainPreStopProcessing
 #define configPOST_STOP_PROCESSING vMainPostStopProcessing
 
+/* Tickless idle: the clock timebase is suspended while the core sleeps and the
+ * elapsed clock ticks are delivered at once on wake-up (see low_power.c). */
+#if defined(__ICCARM__) || defined(__CC_ARM) || defined(__GNUC__)
+void LowPowerSleepEnter(uint32_t expected_idle_ticks);
+void LowPowerSleepExit(uint32_t expected_idle_ticks);
+#endif /* defined(__ICCARM__) || defined(__CC_ARM) || defined(__GNUC__) */
+
+#define configPRE_SLEEP_PROCESSING(x)  LowPowerSleepEnter(x)
+#define configPOST_SLEEP_PROCESSING(x) LowPowerSleepExit(x)
+
+/* Count every context switch, so the cost of each task design can be compared
+ * on the target (see task_timing.h). */
+#if defined(__ICCARM__) || defined(__CC_ARM) || defined(__GNUC__)
+#include <stdint.h>
+extern volatile uint32_t task_timing_switches;
+#endif /* defined(__ICCARM__) || defined(__CC_ARM) || defined(__GNUC__) */
+
+#define traceTASK_SWITCHED_IN() task_timing_switches++
+
 /* Definitions that map the FreeRTOS port interrupt handlers to their CMSIS
  * standard names. */
 #define vPortSVCHandler     SVC_Handler
@@ -36,8 +36,23 @@ extern "C" {
 
 #include "digital.h"
 #include "screen.h"
+#include "task_timing.h"
+#include "timebase.h"
 /* === Public data type declarations =============================================================================== */
 
+/**
+ * @brief Bit de cada tecla en las máscaras del grupo de teclas de la placa.
+ */
+
+typedef enum {
+    BOARD_KEY_SET_TIME,  /**< Botón de configurar hora */
+    BOARD_KEY_SET_ALARM, /**< Botón de configurar alarma */
+    BOARD_KEY_DECREMENT, /**< Botón de disminuir valor */
+    BOARD_KEY_INCREMENT, /**< Botón de aumentar valor */
+    BOARD_KEY_ACCEPT,    /**< Botón de aceptar */
+    BOARD_KEY_CANCEL,    /**< Botón de cancelar */
+    BOARD_KEYS,          /**< Cantidad de teclas */
+} board_key_t;
 
 /**
  * @struct BoardS
@@ -58,11 +73,17 @@ typedef struct BoardS {
     DigitalInputT increment;    /**< Entrada digital para botón de aumentar valor */
     DigitalInputT accept;       /**< Entrada digital para botón de aceptar */ 
     DigitalInputT cancel;       /**< Entrada digital para botón de cancelar */
+    DigitalInputGroupT keys;    /**< Todas las teclas, leídas juntas, en el orden de board_key_t */
     ScreenT screen;             /**< Pantalla de 7 segmentos multiplexada */
+    timebase_driver_t timebase; /**< Base de tiempo que hace avanzar el reloj */
+    timebase_driver_t display_timer; /**< Temporizador que multiplexa la pantalla desde su interrupción */
 
 } const * BoardT;
 /* === Public variable declarations ================================================================================ */
 
+/** @brief Jitter y deriva de la interrupción del multiplexado, en microsegundos del temporizador de la pantalla */
+extern task_timing_t board_display_timing;
+
 /* === Public function declarations ================================================================================ */
 
 
@@ -74,9 +95,7 @@ typedef struct BoardS {
  * @return BoardT Puntero constante a la estructura con los periféricos inicializados.
  */
 
-BoardT BoardCreate(void); //! <-- Crea la estructura de la placa y asigna los pines a los leds y botones
-
-void SysTickInit(uint32_t ticks);
+BoardT BoardCreate(void); //! <-- Crea la placa y asigna los pines a los leds y botones; NULL si falla
 
 /* === End of conditional blocks =================================================================================== */
 
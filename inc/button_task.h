@@ -21,7 +21,7 @@ SPDX-License-Identifier: MIT
 #define BUTTON_TASK_H_
 
 /** @file button_task.h
- ** @brief Declaraciones para la capa de soporte de hardware
+ ** @brief Declaraciones para la tarea que atiende las teclas de la placa
  **/
 
 /* === Headers files inclusions ==================================================================================== */
@@ -30,6 +30,8 @@ SPDX-License-Identifier: MIT
 #include "bsp.h"
 #include "FreeRTOS.h"
 #include "queue.h"
+#include "fsm.h"
+#include "key_edges.h"
 
 /* === Header for C++ compatibility ================================================================================ */
 
@@ -41,29 +43,6 @@ extern "C" {
 
 /* === Public data type declarations =============================================================================== */
 
-/**
- * @enum event_t
- * @brief Tipos de eventos que puede generar la interfaz de usuario mediante los botones.
- */
-
-typedef enum {
-    EV_SET_TIME,
-    EV_SET_ALARM,
-    EV_ACCEPT,
-    EV_CANCEL,
-    EV_INCREMENT,
-    EV_DECREMENT
-} event_t;
-
-/**
- * @struct app_event_t
- * @brief Estructura que encapsula un evento generado por los botones.
- */
-
-typedef struct {
-    event_t type;
-} app_event_t;
-
 /* === Public variable declarations ================================================================================ */
 
 /* === Public function declarations ================================================================================ */
@@ -72,13 +51,21 @@ typedef struct {
  * @brief Inicializa la tarea de botones.
  *
  * Esta función configura la tarea de FreeRTOS que se encarga de leer los botones del sistema y enviar
- * eventos al queue especificado.
+ * los eventos detectados al bus de eventos (EventBusSendKey).
  *
  * @param board Instancia de la placa a la que pertenecen los botones.
- * @param xEvtQueue Handle de la cola de eventos donde se publicarán los eventos detectados.
  */
 
-void ButtonTaskInit(BoardT board, QueueHandle_t xEvtQueue);
+void ButtonTaskInit(BoardT board);
+
+/**
+ * @brief Cola de flancos de las teclas, para inspeccionar en tiempo de ejecución los descartes y la mayor demora
+ * entre una interrupción y su muestreo.
+ *
+ * @return Cola de flancos de la tarea de botones.
+ */
+
+const key_edges_t * ButtonTaskEdges(void);
 
 /* === End of conditional blocks =================================================================================== */
 
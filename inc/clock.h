@@ -44,6 +44,24 @@ extern "C" {
 #include <stdbool.h>
 #include <stdint.h>
 
+/** @brief Cantidad máxima de alarmas de cada reloj */
+#ifndef CLOCK_MAX_ALARMS
+#define CLOCK_MAX_ALARMS 8
+#endif
+
+/** @brief Identificador de la alarma que usan las funciones sin identificador (ClockSetAlarm, etc.) */
+#define CLOCK_DEFAULT_ALARM 0
+
+/** @brief Cantidad máxima de observadores de cambios de la hora por cada reloj */
+#ifndef CLOCK_MAX_OBSERVERS
+#define CLOCK_MAX_OBSERVERS 4
+#endif
+
+/** @brief Cantidad de relojes del pool estático que reparte ClockCreate */
+#ifndef CLOCK_MAX_INSTANCES
+#define CLOCK_MAX_INSTANCES 4
+#endif
+
 /* === Public data type declarations =============================================================================== */
 
 /**
@@ -64,6 +82,45 @@ typedef union {
 
 typedef struct clock_s * clock_t;
 
+/**
+ * @brief Hora en formato BCD empaquetado en una sola palabra de 32 bits.
+ *
+ * Cada nibble guarda un dígito en el mismo orden que clock_time_t.bcd: el nibble 0 son las unidades de
+ * segundos y el nibble 5 las decenas de horas. Los 8 bits superiores quedan en cero.
+ */
+
+typedef uint32_t clock_packed_t;
+
+/** @brief Máscara de la palabra empaquetada que cubre horas, minutos y segundos */
+#define CLOCK_PACKED_MASK_ALL   0x00FFFFFFu
+
+/** @brief Máscara de la palabra empaquetada que cubre solo horas y minutos */
+#define CLOCK_PACKED_MASK_HHMM  0x00FFFF00u
+
+
+/**
+ * @brief Flancos de la hora que pueden notificarse a un observador. Se combinan como máscara de bits.
+ */
+
+typedef enum {
+    CLOCK_EDGE_SECOND = (1 << 0), //!< Cambió el segundo
+    CLOCK_EDGE_MINUTE = (1 << 1), //!< Cambió el minuto
+    CLOCK_EDGE_HOUR = (1 << 2),   //!< Cambió la hora
+    CLOCK_EDGE_DAY = (1 << 3)     //!< Pasó la medianoche
+} clock_edge_t;
+
+/**
+ * @brief Función que recibe las notificaciones de cambio de la hora.
+ *
+ * Se llama desde el mismo contexto que ClockNewTick o ClockAdvanceTicks (tarea o interrupción), por lo que debe
+ * ser breve; para despertar a otra tarea conviene usar una notificación de FreeRTOS.
+ *
+ * @param clock Reloj cuya hora cambió.
+ * @param edges Máscara de clock_edge_t con los flancos ocurridos.
+ * @param context Puntero registrado junto con la función.
+ */
+
+typedef void (*clock_observer_t)(clock_t clock, uint8_t edges, void * context);
 
 /* === Public variable declarations ================================================================================ */
 
@@ -72,15 +129,49 @@ typedef struct clock_s * clock_t;
 /**
  * @brief Crea una nueva instancia del reloj.
  *
+ * Las instancias se toman de un pool estático de CLOCK_MAX_INSTANCES relojes independientes, cada uno con sus
+ * propios ticks por segundo.
+ *
  * @param ticks_per_second Número de ticks requeridos para que avance un segundo.
- * @return clock_t Puntero al nuevo reloj creado.
+ * @return clock_t Puntero al nuevo reloj creado, o NULL si el pool está agotado.
  */
 
 clock_t ClockCreate (uint16_t ticks_per_second);
 
+/**
+ * @brief Libera una instancia del reloj y la devuelve al pool.
+ *
+ * @param clock Instancia del reloj (puede ser NULL).
+ */
+
+void ClockDestroy(clock_t clock);
+
+/**
+ * @brief Indica a todos los relojes activos que pasó un tick de la base de tiempo común.
+ *
+ * Cada reloj cuenta los ticks según su propio valor de ticks_per_second, por lo que una sola tarea o
+ * interrupción puede mantener todos los relojes del sistema.
+ *
+ * @return true si en este tick se disparó la alarma de alguno de los relojes.
+ */
+
+bool ClockNewTickAll(void);
+
+/**
+ * @brief Avanza todos los relojes activos una cantidad arbitraria de ticks de la base de tiempo común.
+ *
+ * @param ticks Cantidad de ticks transcurridos.
+ * @return true si en el intervalo coincidió la alarma de alguno de los relojes.
+ */
+
+bool ClockAdvanceTicksAll(uint32_t ticks);
+
 /**
  * @brief Obtiene la hora actual del reloj.
  *
+ * No toma ningún mutex ni bloquea al reloj: puede llamarse desde cualquier tarea o interrupción y siempre devuelve
+ * una hora coherente. Las funciones que modifican el reloj deben llamarse desde un solo contexto a la vez.
+ *
  * @param clock Instancia del reloj.
  * @param result Puntero donde se almacenará la hora actual.
  * @return true si la hora es válida, false en caso contrario.
@@ -102,11 +193,28 @@ bool ClockSetTime(clock_t clock, const clock_time_t * new_time);
  * @brief Indica al reloj que ha pasado un tick de reloj.
  *
  * Llama a esta función periódicamente (según el valor de ticks_per_second) para actualizar la hora.
+ * El reloj mantiene una cuenta regresiva hasta la alarma, por lo que no hace falta consultar
+ * ClockAlarmMatchTheTime en cada tick: basta con reaccionar cuando esta función devuelve true.
  *
  * @param clock Instancia del reloj.
+ * @return true solo en el tick en que la hora entra en el minuto de la alarma habilitada.
  */
 
-void ClockNewTick(clock_t clock);
+bool ClockNewTick(clock_t clock);
+
+/**
+ * @brief Avanza el reloj una cantidad arbitraria de ticks en tiempo constante.
+ *
+ * Reemplaza a un lazo de llamadas a ClockNewTick para ponerse al día luego de una demora, al salir de un modo de
+ * bajo consumo o para simular períodos largos en las pruebas. Maneja el paso por la medianoche y el rearmado de
+ * la alarma cancelada por hoy.
+ *
+ * @param clock Instancia del reloj.
+ * @param ticks Cantidad de ticks transcurridos.
+ * @return true si la alarma habilitada coincidió con la hora en algún momento del intervalo.
+ */
+
+bool ClockAdvanceTicks(clock_t clock, uint32_t ticks);
 
 /**
  * @brief Establece una nueva hora de alarma.
@@ -118,6 +226,21 @@ void ClockNewTick(clock_t clock);
 
 bool ClockSetAlarm(clock_t self, const clock_time_t * alarm_time);
 
+/**
+ * @brief Establece la hora de una alarma de la tabla.
+ *
+ * Cada reloj tiene CLOCK_MAX_ALARMS alarmas, cada una con su propia habilitación, cancelación por hoy y
+ * tiempo pospuesto. Las alarmas se mantienen en un índice ordenado por hora de disparo, de modo que el costo
+ * de cada tick no depende de cuántas haya configuradas.
+ *
+ * @param self Instancia del reloj.
+ * @param id Identificador de la alarma (0 a CLOCK_MAX_ALARMS - 1).
+ * @param alarm_time Puntero a la hora deseada de la alarma.
+ * @return true si se configuró correctamente, false si el identificador no existe.
+ */
+
+bool ClockSetAlarmById(clock_t self, uint8_t id, const clock_time_t * alarm_time);
+
 /**
  * @brief Obtiene la hora actualmente configurada como alarma.
  *
@@ -128,6 +251,17 @@ bool ClockSetAlarm(clock_t self, const clock_time_t * alarm_time);
 
 bool ClockGetAlarm(clock_t self, clock_time_t * alarm_time);
 
+/**
+ * @brief Obtiene la hora efectiva de una alarma de la tabla, incluido lo pospuesto.
+ *
+ * @param self Instancia del reloj.
+ * @param id Identificador de la alarma.
+ * @param alarm_time Puntero donde se almacenará la hora de la alarma.
+ * @return true si se obtuvo correctamente, false si el identificador no existe.
+ */
+
+bool ClockGetAlarmById(clock_t self, uint8_t id, clock_time_t * alarm_time);
+
 
 /**
  * @brief Verifica si la hora actual coincide con la hora de alarma.
@@ -138,6 +272,16 @@ bool ClockGetAlarm(clock_t self, clock_time_t * alarm_time);
 
 bool ClockAlarmMatchTheTime(clock_t self);
 
+/**
+ * @brief Verifica si la hora actual coincide con una alarma de la tabla.
+ *
+ * @param self Instancia del reloj.
+ * @param id Identificador de la alarma.
+ * @return true si la hora actual coincide y la alarma está habilitada.
+ */
+
+bool ClockAlarmMatchTheTimeById(clock_t self, uint8_t id);
+
 /**
  * @brief Habilita la alarma.
  *
@@ -146,6 +290,15 @@ bool ClockAlarmMatchTheTime(clock_t self);
 
 void ClockEnableAlarm(clock_t self);
 
+/**
+ * @brief Habilita una alarma de la tabla.
+ *
+ * @param self Instancia del reloj.
+ * @param id Identificador de la alarma.
+ */
+
+void ClockEnableAlarmById(clock_t self, uint8_t id);
+
 /**
  * @brief Deshabilita la alarma.
  *
@@ -154,6 +307,15 @@ void ClockEnableAlarm(clock_t self);
 
 void ClockDisableAlarm(clock_t self);
 
+/**
+ * @brief Deshabilita una alarma de la tabla y descarta lo pospuesto.
+ *
+ * @param self Instancia del reloj.
+ * @param id Identificador de la alarma.
+ */
+
+void ClockDisableAlarmById(clock_t self, uint8_t id);
+
 /**
  * @brief Consulta si la alarma está habilitada.
  *
@@ -163,6 +325,29 @@ void ClockDisableAlarm(clock_t self);
 
 bool ClockIsAlarmEnabled(clock_t self);
 
+/**
+ * @brief Consulta si una alarma de la tabla está habilitada.
+ *
+ * @param self Instancia del reloj.
+ * @param id Identificador de la alarma.
+ * @return true si la alarma está activa.
+ */
+
+bool ClockIsAlarmEnabledById(clock_t self, uint8_t id);
+
+/**
+ * @brief Consulta cuánto falta para que suene la próxima alarma habilitada.
+ *
+ * La cuenta regresiva se recalcula solo al cambiar la hora o la hora de una alarma. Si la hora ya está dentro
+ * del minuto de la alarma, informa el tiempo hasta el día siguiente.
+ *
+ * @param self Instancia del reloj.
+ * @param seconds Puntero donde se almacenan los segundos que faltan para el minuto de la alarma.
+ * @return true si hay alguna alarma habilitada y la hora es válida, false en caso contrario.
+ */
+
+bool ClockTimeUntilAlarm(clock_t self, uint32_t * seconds);
+
 /**
  * @brief Pospone la alarma una cantidad arbitraria de minutos.
  *
@@ -175,11 +360,109 @@ bool ClockIsAlarmEnabled(clock_t self);
 
 void ClockPostponeAlarm(clock_t self, uint8_t minutes);
 
+/**
+ * @brief Pospone una alarma de la tabla una cantidad arbitraria de minutos.
+ *
+ * Lo pospuesto se acumula aparte de la hora programada: al cancelar la alarma por hoy o deshabilitarla,
+ * vuelve a sonar a la hora en que estaba programada.
+ *
+ * @param self Instancia del reloj.
+ * @param id Identificador de la alarma.
+ * @param minutes Minutos que se desean añadir a la hora de alarma.
+ */
+
+void ClockPostponeAlarmById(clock_t self, uint8_t id, uint8_t minutes);
+
+/**
+ * @brief Convierte una hora BCD de 6 bytes a su forma empaquetada de 32 bits.
+ *
+ * @param time Hora en formato BCD.
+ * @return Hora empaquetada, un dígito por nibble.
+ */
+
+clock_packed_t ClockTimePack(const clock_time_t * time);
+
+/**
+ * @brief Convierte una hora empaquetada de 32 bits a la forma BCD de 6 bytes.
+ *
+ * @param packed Hora empaquetada.
+ * @param time Puntero donde se almacenará la hora en formato BCD.
+ */
+
+void ClockTimeUnpack(clock_packed_t packed, clock_time_t * time);
+
+/**
+ * @brief Incrementa un segundo una hora empaquetada.
+ *
+ * Propaga el acarreo entre todos los dígitos a la vez (SWAR) con la corrección BCD de sumar 6 y vuelve a
+ * 00:00:00 después de las 23:59:59.
+ *
+ * @param packed Hora empaquetada válida.
+ * @return Hora empaquetada un segundo después.
+ */
+
+clock_packed_t ClockPackedIncrement(clock_packed_t packed);
+
+/**
+ * @brief Compara dos horas empaquetadas solo en los dígitos seleccionados por la máscara.
+ *
+ * @param first Primera hora empaquetada.
+ * @param second Segunda hora empaquetada.
+ * @param mask Dígitos a comparar, por ejemplo CLOCK_PACKED_MASK_HHMM para la alarma.
+ * @return true si coinciden todos los dígitos seleccionados.
+ */
+
+bool ClockPackedMatch(clock_packed_t first, clock_packed_t second, clock_packed_t mask);
+
+/**
+ * @brief Suma un desplazamiento con signo a un campo BCD de dos dígitos, dando la vuelta en el módulo.
+ *
+ * Reemplaza aplicar uno por uno los pasos de aumentar o disminuir: el resultado de sumar N es el mismo que el de N
+ * incrementos, en una sola operación.
+ *
+ * @param value Campo BCD de dos dígitos (unidades, decenas), por ejemplo las horas o los minutos.
+ * @param delta Pasos a sumar, negativos para restar.
+ * @param modulo Cantidad de valores del campo: 24 para las horas, 60 para los minutos.
+ */
+
+void ClockBcdAdjust(uint8_t value[2], int16_t delta, uint8_t modulo);
+
+/**
+ * @brief Registra un observador que se llama cuando la hora cruza alguno de los flancos indicados.
+ *
+ * Permite que los consumidores de la hora trabajen solo cuando algo cambió, en lugar de consultarla en cada tick.
+ *
+ * @param self Instancia del reloj.
+ * @param edges Máscara de clock_edge_t con los flancos de interés.
+ * @param observer Función a llamar.
+ * @param context Puntero que se entrega a la función en cada llamada.
+ * @return true si se registró, false si ya hay CLOCK_MAX_OBSERVERS observadores.
+ */
+
+bool ClockAddObserver(clock_t self, uint8_t edges, clock_observer_t observer, void * context);
+
+/**
+ * @brief Quita un observador registrado con ClockAddObserver.
+ *
+ * @param self Instancia del reloj.
+ * @param observer Función registrada.
+ * @param context Puntero registrado junto con la función.
+ */
+
+void ClockRemoveObserver(clock_t self, clock_observer_t observer, void * context);
+
 bool ClockCancelSetTime(clock_t self);
 
 void ClockCancelAlarmToday(clock_t self);
 
-void HandleAlarm(void);
+/**
+ * @brief Cancela una alarma de la tabla solo por hoy; se rearma sola al pasar la medianoche.
+ *
+ * @param self Instancia del reloj.
+ * @param id Identificador de la alarma.
+ */
+
+void ClockCancelAlarmTodayById(clock_t self, uint8_t id);
 
 void CancelAlarm(void);
 
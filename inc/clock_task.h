@@ -20,16 +20,16 @@ SPDX-License-Identifier: MIT
 #ifndef CLOCK_TASK_H_
 #define CLOCK_TASK_H_
 
-/** @file cloc_task.h
- ** @brief Declaraciones para la tarea que maneja el reloj digital
+/** @file clock_task.h
+ ** @brief Declaraciones para el avance del reloj desde la base de tiempo de la placa
  **/
 
 /* === Headers files inclusions ==================================================================================== */
 
 #include "FreeRTOS.h"
 #include "task.h"
-#include "semphr.h"
 #include "clock.h"
+#include "timebase.h"
 
 /* === Header for C++ compatibility ================================================================================ */
 
@@ -39,21 +39,31 @@ extern "C" {
 
 /* === Public macros definitions =================================================================================== */
 
+/**
+ * @brief Frecuencia de la base de tiempo del reloj. Con la base de tiempo del tick de FreeRTOS
+ * (BOARD_TIMEBASE_TICK_HOOK) debe ser igual a configTICK_RATE_HZ.
+ */
+#ifndef CLOCK_TICKS_PER_SECOND
+#ifdef BOARD_TIMEBASE_TICK_HOOK
+#define CLOCK_TICKS_PER_SECOND configTICK_RATE_HZ
+#else
+#define CLOCK_TICKS_PER_SECOND 100
+#endif
+#endif
+
 /* === Public data type declarations =============================================================================== */
 
 /**
- * @enum clock_state_t
- * @brief Estados posibles de la máquina de estados del reloj.
+ * @brief Costo de hacer avanzar el reloj desde la base de tiempo, para medir cada una en la placa.
  */
 
-typedef enum {
-    STATE_CLOCK_INIT,
-    STATE_NORMAL,
-    STATE_SET_HOURS,
-    STATE_SET_MINUTES,
-    STATE_SET_ALARM_HOURS,
-    STATE_SET_ALARM_MINUTES
-} clock_state_t;
+typedef struct {
+    uint32_t interrupts; //!< Interrupciones atendidas
+    uint32_t ticks;      //!< Ticks del reloj entregados por la base de tiempo
+    uint32_t cycles;     //!< Ciclos de CPU acumulados dentro de ClockNewTickFromISR
+    uint32_t max_cycles; //!< Mayor cantidad de ciclos en una sola interrupción
+    uint32_t wakeups;    //!< Veces que la interrupción despertó a una tarea (cambios de contexto provocados)
+} clock_timebase_stats_t;
 
 
 
@@ -66,35 +76,47 @@ typedef enum {
 
 uint32_t ClockGetTicks(void);
 
-/** @brief Mutex para proteger el acceso a la variable de estado compartida */
-
-extern SemaphoreHandle_t xStateMutex;
-
 /** @brief Instancia del reloj principal del sistema */
 
 extern clock_t clock;
 
-/** @brief Estructura con la hora y minutos actuales del reloj */
+/** @brief Costo de la base de tiempo del reloj, para inspeccionar en tiempo de ejecución */
+
+extern clock_timebase_stats_t clock_timebase_stats;
+
+/* === Public function declarations ================================================================================ */
 
-extern clock_time_t time_clock;
+/**
+ * @brief Hace avanzar todos los relojes. Se llama desde la interrupción de la base de tiempo.
+ *
+ * No bloquea ni toma mutex; si se dispara una alarma la informa con HandleAlarmFromISR y, si eso despierta a una
+ * tarea de mayor prioridad, pide el cambio de contexto al salir de la interrupción.
+ *
+ * @param ticks Ticks transcurridos desde la llamada anterior.
+ * @param context No utilizado.
+ */
 
-/** @brief Estado actual de la máquina de estados del reloj */
+void ClockNewTickFromISR(uint32_t ticks, void * context);
 
-extern clock_state_t state;  // Variable global compartida
+/**
+ * @brief Pone en marcha el reloj sobre la base de tiempo indicada, sin necesidad de una tarea.
+ *
+ * @param timebase Base de tiempo que genera los ticks del reloj.
+ * @return true si la base de tiempo pudo generar CLOCK_TICKS_PER_SECOND.
+ */
 
-/* === Public function declarations ================================================================================ */
+bool ClockTaskStart(timebase_driver_t timebase);
 
 /**
- * @brief Tarea de FreeRTOS que gestiona el reloj digital.
+ * @brief Avisa a la máquina de estados por el bus de eventos (EVENT_BUS_ALARM) que la alarma se disparó.
  *
- * Esta función implementa la máquina de estados del reloj, manejando los estados de inicialización,
- * operación normal y ajuste de hora/alarma. La tarea actualiza la hora, gestiona la alarma y
- * protege los accesos compartidos mediante semáforos.
+ * La llama la interrupción de la base de tiempo una sola vez, cuando la cuenta regresiva de la alarma llega a cero;
+ * es el único origen de las verificaciones de la alarma.
  *
- * @param pvParameters Puntero a parámetros de la tarea (generalmente NULL)
+ * @param higher_priority_woken Se pone en pdTRUE si el aviso despertó a una tarea de mayor prioridad.
  */
 
-void vClockTask(void *pvParameters);
+void HandleAlarmFromISR(BaseType_t * higher_priority_woken);
 
 /* === End of conditional blocks =================================================================================== */
 
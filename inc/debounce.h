@@ -0,0 +1,107 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Roldan JesusAlejandro <kechuroldanjesus@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+#ifndef DEBOUNCE_H_
+#define DEBOUNCE_H_
+
+/** @file debounce.h
+ ** @brief Antirrebote en paralelo de hasta 32 teclas con contadores verticales.
+ *
+ * Cada tecla ocupa un bit de una máscara. El estado filtrado de una tecla cambia recién cuando se leen
+ * DEBOUNCE_SAMPLES muestras seguidas distintas de él; cualquier muestra igual reinicia su contador. Los contadores
+ * de todas las teclas se actualizan juntos con unas pocas operaciones de bits, sin esperas.
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include <stdint.h>
+
+/* === Header for C++ compatibility ================================================================================ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions =================================================================================== */
+
+/** @brief Muestras seguidas necesarias para aceptar un cambio (fijo por los contadores de dos bits) */
+#define DEBOUNCE_SAMPLES 4
+
+/* === Public data type declarations =============================================================================== */
+
+/**
+ * @brief Estado del antirrebote de un grupo de teclas.
+ */
+
+typedef struct {
+    uint32_t state;   //!< Estado filtrado, un bit por tecla
+    uint32_t count_0; //!< Bit menos significativo del contador de cada tecla
+    uint32_t count_1; //!< Bit más significativo del contador de cada tecla
+} debounce_t;
+
+/**
+ * @brief Resultado de procesar una muestra.
+ */
+
+typedef struct {
+    uint32_t state;    //!< Estado filtrado después de la muestra
+    uint32_t pressed;  //!< Teclas que pasaron a activas en esta muestra
+    uint32_t released; //!< Teclas que pasaron a inactivas en esta muestra
+} debounce_edges_t;
+
+/* === Public variable declarations ================================================================================ */
+
+/* === Public function declarations ================================================================================ */
+
+/**
+ * @brief Inicializa el antirrebote.
+ *
+ * @param self Estado del antirrebote.
+ * @param state Estado inicial de las teclas.
+ */
+
+void DebounceInit(debounce_t * self, uint32_t state);
+
+/**
+ * @brief Procesa una muestra de todas las teclas.
+ *
+ * @param self Estado del antirrebote.
+ * @param sample Estado leído de las teclas, un bit por tecla.
+ * @return Estado filtrado y flancos de activación y liberación de todas las teclas.
+ */
+
+debounce_edges_t DebounceUpdate(debounce_t * self, uint32_t sample);
+
+/**
+ * @brief Indica si hay teclas cuyo estado leído todavía no coincide con el filtrado.
+ *
+ * @param self Estado del antirrebote.
+ * @param sample Última muestra procesada.
+ * @return distinto de cero si hay cambios pendientes.
+ */
+
+uint32_t DebouncePending(const debounce_t * self, uint32_t sample);
+
+/* === End of conditional blocks =================================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* DEBOUNCE_H_ */
@@ -35,12 +35,32 @@ extern "C" {
 
 /* === Public macros definitions =================================================================================== */
 
+/** @brief Cantidad de canales de interrupción por pin (PININT) del microcontrolador */
+#define DIGITAL_INTERRUPT_CHANNELS 8
+
+/** @brief Cantidad máxima de entradas en un grupo (una por bit de la máscara) */
+#define DIGITAL_GROUP_MAX_INPUTS 32
+
+/** @brief Cantidad de puertos GPIO del microcontrolador */
+#define DIGITAL_GROUP_MAX_PORTS 8
+
 /* === Public data type declarations =============================================================================== */
 
 typedef struct DigitalOutputS * DigitalOutputT;
 
 typedef struct DigitalInputS * DigitalInputT;
 
+typedef struct DigitalInputGroupS * DigitalInputGroupT;
+
+/**
+ * @brief Función que se llama, desde la interrupción, cuando una entrada cambia de estado.
+ * @param input Entrada que cambió.
+ * @param active Estado de la entrada después del flanco, ya con la lógica invertida aplicada.
+ * @param context Puntero entregado al habilitar la interrupción.
+ */
+
+typedef void (*digital_input_handler_t)(DigitalInputT input, bool active, void * context);
+
 /* === Public variable declarations ================================================================================ */
 
 /* === Public function declarations ================================================================================ */
@@ -56,6 +76,14 @@ typedef struct DigitalInputS * DigitalInputT;
 
 DigitalOutputT DigitalOutputCreate(int gpio, int bit, bool state); //! <- crea un objeto salida
 
+/**
+ * @brief Libera un objeto de salida digital; el pin queda en el último estado escrito.
+ *
+ * @param self Objeto de salida digital (puede ser NULL).
+ */
+
+void DigitalOutputDestroy(DigitalOutputT self);
+
 /**
  * @brief Activa (pone en nivel alto) la salida digital.
  *
@@ -92,6 +120,14 @@ void DigitalOutputToggle(DigitalOutputT self);
 
 DigitalInputT DigitalInputCreate(int port, int pin, bool inverted); //! <- crea un objeto entrada
 
+/**
+ * @brief Libera un objeto de entrada digital; no debe tener la interrupción habilitada ni estar en un grupo.
+ *
+ * @param self Objeto de entrada digital (puede ser NULL).
+ */
+
+void DigitalInputDestroy(DigitalInputT self);
+
 /**
  * @brief Obtiene el estado actual de la entrada digital.
  *
@@ -129,6 +165,57 @@ bool DigitalInputHasActivate(DigitalInputT self);
 
 bool DigitalInputHasDeactivate(DigitalInputT self);
 
+/**
+ * @brief Habilita la interrupción por ambos flancos de la entrada en un canal PININT.
+ *
+ * @param self Objeto de entrada digital.
+ * @param channel Canal de interrupción, de 0 a DIGITAL_INTERRUPT_CHANNELS - 1 (uno por entrada).
+ * @param handler Función a llamar en cada flanco.
+ * @param context Puntero que se entrega a la función.
+ * @return true si se habilitó, false si el canal no existe.
+ */
+
+bool DigitalInputEnableInterrupt(DigitalInputT self, uint8_t channel, digital_input_handler_t handler,
+                                 void * context);
+
+/**
+ * @brief Crea un grupo de entradas vacío.
+ *
+ * @return Grupo creado, o NULL si falla la reserva de memoria.
+ */
+
+DigitalInputGroupT DigitalInputGroupCreate(void);
+
+/**
+ * @brief Libera un grupo de entradas, sin liberar las entradas que contiene.
+ *
+ * @param self Grupo de entradas (puede ser NULL).
+ */
+
+void DigitalInputGroupDestroy(DigitalInputGroupT self);
+
+/**
+ * @brief Agrega una entrada al grupo; ocupa el siguiente bit de las máscaras.
+ *
+ * @param self Grupo de entradas.
+ * @param input Entrada a agregar.
+ * @return true si se agregó, false si el grupo está lleno.
+ */
+
+bool DigitalInputGroupAdd(DigitalInputGroupT self, DigitalInputT input);
+
+/**
+ * @brief Lee todas las entradas del grupo, con un solo acceso por cada puerto GPIO que usan.
+ *
+ * Los flancos filtrados los calcula el antirrebote a partir de estas muestras, así que el grupo no guarda la
+ * lectura anterior.
+ *
+ * @param self Grupo de entradas.
+ * @return Estado actual, un bit por entrada en el orden en que se agregaron y con la lógica invertida aplicada.
+ */
+
+uint32_t DigitalInputGroupScan(DigitalInputGroupT self);
+
 /* === End of conditional blocks =================================================================================== */
 
 #ifdef __cplusplus
@@ -0,0 +1,154 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Roldan JesusAlejandro <kechuroldanjesus@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+#ifndef EVENT_BUS_H_
+#define EVENT_BUS_H_
+
+/** @file event_bus.h
+ ** @brief Bus de eventos de la aplicación: un único consumidor (la máquina de estados) despertado por los bits de
+ * notificación de su tarea.
+ *
+ * Cada tipo de evento es un bit. Las interrupciones y las tareas solo encienden bits, así que varios avisos del
+ * mismo tipo se juntan en uno y no hay colas que se llenen. Los eventos de teclas, que llevan datos, se guardan en una
+ * cola propia del bus y se avisan con EVENT_BUS_KEY. El consumidor atiende los bits en orden de prioridad: el bit
+ * más bajo primero.
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "FreeRTOS.h"
+#include "task.h"
+#include "fsm.h"
+#include <stdbool.h>
+#include <stdint.h>
+
+/* === Header for C++ compatibility ================================================================================ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions =================================================================================== */
+
+/** @brief Cantidad de eventos de teclas que se pueden acumular sin atender */
+#ifndef EVENT_BUS_KEY_QUEUE_LENGTH
+#define EVENT_BUS_KEY_QUEUE_LENGTH 10
+#endif
+
+/* === Public data type declarations =============================================================================== */
+
+/**
+ * @brief Eventos del bus, ordenados por prioridad.
+ */
+
+typedef enum {
+    EVENT_BUS_ALARM_OFF = 1u << 0, //!< Se pidió apagar la alarma que está sonando (CancelAlarm)
+    EVENT_BUS_ALARM = 1u << 1,     //!< La cuenta regresiva de la alarma llegó a cero
+    EVENT_BUS_KEY = 1u << 2,       //!< Hay eventos de teclas en la cola
+    EVENT_BUS_TIMEOUT = 1u << 3,   //!< Venció el tiempo de espera del consumidor, por ejemplo por inactividad
+    EVENT_BUS_SECOND = 1u << 4,    //!< El reloj pasó al segundo siguiente
+} event_bus_event_t;
+
+/**
+ * @brief Contadores del bus.
+ */
+
+typedef struct {
+    uint32_t posts;        //!< Avisos recibidos, incluidos los que se juntaron con uno pendiente
+    uint32_t wakeups;      //!< Veces que el consumidor se despertó
+    uint32_t key_overruns; //!< Envíos de eventos de teclas que encontraron la cola llena
+} event_bus_stats_t;
+
+/* === Public variable declarations ================================================================================ */
+
+/** @brief Contadores del bus */
+extern event_bus_stats_t event_bus_stats;
+
+/* === Public function declarations ================================================================================ */
+
+/**
+ * @brief Crea la cola de eventos de teclas y registra la tarea que consume el bus.
+ *
+ * @param consumer Tarea que llama a EventBusWait.
+ * @return false si no se pudo crear la cola.
+ */
+
+bool EventBusInit(TaskHandle_t consumer);
+
+/**
+ * @brief Avisa eventos desde una tarea.
+ *
+ * @param events Máscara de event_bus_event_t.
+ */
+
+void EventBusPost(uint32_t events);
+
+/**
+ * @brief Avisa eventos desde una interrupción.
+ *
+ * @param events Máscara de event_bus_event_t.
+ * @param higher_priority_woken Se pone en pdTRUE si hay que cambiar de tarea al salir de la interrupción.
+ */
+
+void EventBusPostFromISR(uint32_t events, BaseType_t * higher_priority_woken);
+
+/**
+ * @brief Encola un evento de teclas y avisa EVENT_BUS_KEY.
+ *
+ * @param event Evento a enviar.
+ * @param wait Tiempo máximo a esperar lugar en la cola.
+ * @return false si la cola siguió llena.
+ */
+
+bool EventBusSendKey(const app_event_t * event, TickType_t wait);
+
+/**
+ * @brief Saca el evento de teclas más antiguo, sin esperar. Lo llama el consumidor al atender EVENT_BUS_KEY.
+ *
+ * @param event Donde se copia el evento.
+ * @return false si no quedan eventos.
+ */
+
+bool EventBusReceiveKey(app_event_t * event);
+
+/**
+ * @brief Espera eventos. Lo llama solo la tarea consumidora.
+ *
+ * @param timeout Tiempo máximo de espera.
+ * @return Eventos pendientes, o EVENT_BUS_TIMEOUT si venció el tiempo sin ningún aviso.
+ */
+
+uint32_t EventBusWait(TickType_t timeout);
+
+/**
+ * @brief Saca de la máscara el evento de mayor prioridad.
+ *
+ * @param pending Eventos pendientes; se borra el que se devuelve.
+ * @return Evento de mayor prioridad, o 0 si no queda ninguno.
+ */
+
+uint32_t EventBusNext(uint32_t * pending);
+
+/* === End of conditional blocks =================================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* EVENT_BUS_H_ */
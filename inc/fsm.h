@@ -0,0 +1,171 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Roldan JesusAlejandro <kechuroldanjesus@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+#ifndef FSM_H_
+#define FSM_H_
+
+/** @file fsm.h
+ ** @brief Máquina de estados de la interfaz del reloj, sin dependencias de FreeRTOS.
+ *
+ * Cada combinación de estado y evento tiene una acción en una tabla constante; la acción devuelve el estado
+ * siguiente y, si cambia, se aplica la acción de entrada de ese estado (el parpadeo de la pantalla). Los efectos
+ * sobre el hardware pasan por un controlador de funciones, igual que la pantalla, así que el módulo se prueba en el
+ * host.
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "clock.h"
+
+/* === Header for C++ compatibility ================================================================================ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions =================================================================================== */
+
+/* === Public data type declarations =============================================================================== */
+
+/**
+ * @enum clock_state_t
+ * @brief Estados posibles de la máquina de estados del reloj.
+ */
+
+typedef enum {
+    STATE_CLOCK_INIT,
+    STATE_NORMAL,
+    STATE_SET_HOURS,
+    STATE_SET_MINUTES,
+    STATE_SET_ALARM_HOURS,
+    STATE_SET_ALARM_MINUTES,
+    STATE_COUNT     /**< Cantidad de estados */
+} clock_state_t;
+
+/**
+ * @enum event_t
+ * @brief Eventos que recibe la máquina de estados: los de los botones y los de la alarma.
+ */
+
+typedef enum {
+    EV_SET_TIME,
+    EV_SET_ALARM,
+    EV_ACCEPT,
+    EV_CANCEL,
+    EV_ADJUST,      /**< Aumentar o disminuir el valor que se está ajustando, según el signo de delta */
+    EV_CLEAR,       /**< Aumentar y disminuir juntos: pone en cero el valor que se está ajustando */
+    EV_ALARM,       /**< Verificar si la alarma coincide con la hora y encenderla */
+    EV_ALARM_OFF,   /**< Apagar la alarma que está sonando */
+    EV_COUNT        /**< Cantidad de eventos */
+} event_t;
+
+/**
+ * @struct app_event_t
+ * @brief Estructura que encapsula un evento para la máquina de estados.
+ */
+
+typedef struct {
+    event_t type;       /**< Evento */
+    int16_t delta;      /**< Pasos a sumar en EV_ADJUST: acumula todas las pulsaciones y repeticiones seguidas */
+    bool long_press;    /**< El evento viene de mantener presionada la tecla */
+} app_event_t;
+
+/**
+ * @brief Puntero a función que hace parpadear un rango de dígitos o de puntos de la pantalla
+ * @param from Primer dígito
+ * @param to Último dígito
+ * @param divisor Factor de parpadeo, 0 para no parpadear
+ */
+
+typedef void (*fsm_flash_t)(uint8_t from, uint8_t to, uint16_t divisor);
+
+/**
+ * @brief Puntero a función que enciende o apaga la señal de la alarma
+ * @param on true para encenderla
+ */
+
+typedef void (*fsm_alarm_output_t)(bool on);
+
+/**
+ * @brief Estructura que define los efectos de la máquina de estados sobre el hardware
+ */
+
+typedef struct fsm_driver_s {
+    fsm_flash_t FlashDigits;        /**< Parpadeo de los dígitos */
+    fsm_flash_t FlashPoints;        /**< Parpadeo de los puntos */
+    fsm_alarm_output_t AlarmOutput; /**< Señal de la alarma sonando */
+} const * fsm_driver_t;
+
+/**
+ * @brief Estado de la máquina de estados.
+ */
+
+typedef struct {
+    clock_state_t state;        /**< Estado actual */
+    clock_t clock;              /**< Reloj que se ajusta */
+    fsm_driver_t driver;        /**< Efectos sobre el hardware */
+    clock_time_t time_clock;    /**< Hora que se está ajustando */
+    clock_time_t time_alarm;    /**< Hora de la alarma que se está ajustando */
+    bool alarm_enabled;         /**< La alarma está habilitada */
+    bool alarm_triggered;       /**< La alarma está sonando */
+    bool alarm_pending;         /**< La alarma se disparó durante una edición y suena al volver al estado normal */
+} fsm_t;
+
+/* === Public variable declarations ================================================================================ */
+
+/* === Public function declarations ================================================================================ */
+
+/**
+ * @brief Inicia la máquina de estados en STATE_CLOCK_INIT.
+ *
+ * @param self Máquina de estados.
+ * @param clock Reloj que se ajusta.
+ * @param driver Efectos sobre el hardware.
+ */
+
+void FsmInit(fsm_t * self, clock_t clock, fsm_driver_t driver);
+
+/**
+ * @brief Atiende un evento con una sola búsqueda en la tabla de transiciones.
+ *
+ * @param self Máquina de estados.
+ * @param event Evento a atender.
+ * @return Estado después del evento.
+ */
+
+clock_state_t FsmDispatch(fsm_t * self, const app_event_t * event);
+
+/**
+ * @brief Indica si la máquina está en uno de los estados de edición de la hora o de la alarma.
+ *
+ * @param self Máquina de estados.
+ * @return true si se está editando.
+ */
+
+bool FsmIsEditing(const fsm_t * self);
+
+/* === End of conditional blocks =================================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* FSM_H_ */
@@ -0,0 +1,172 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Roldan JesusAlejandro <kechuroldanjesus@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+#ifndef GESTURE_H_
+#define GESTURE_H_
+
+/** @file gesture.h
+ ** @brief Detección de gestos sobre el estado filtrado de las teclas: pulsación, pulsación larga, repetición
+ * automática con aceleración y combinaciones de teclas (acordes).
+ *
+ * Las teclas se identifican por su bit en la máscara, igual que en el antirrebote. El módulo no lee el tiempo: se
+ * le entrega en cada actualización, en milisegundos, y avisa cuánto falta para el próximo evento programado.
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/* === Header for C++ compatibility ================================================================================ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions =================================================================================== */
+
+/** @brief Cantidad máxima de teclas */
+#ifndef GESTURE_MAX_KEYS
+#define GESTURE_MAX_KEYS 8
+#endif
+
+/** @brief Cantidad máxima de acordes */
+#ifndef GESTURE_MAX_CHORDS
+#define GESTURE_MAX_CHORDS 4
+#endif
+
+/** @brief Tiempo para completar un acorde; mientras tanto se retiene la pulsación de sus teclas */
+#ifndef GESTURE_CHORD_MS
+#define GESTURE_CHORD_MS 80
+#endif
+
+/** @brief Tiempo que hay que mantener una tecla para la pulsación larga o para empezar a repetir */
+#ifndef GESTURE_LONG_PRESS_MS
+#define GESTURE_LONG_PRESS_MS 600
+#endif
+
+/** @brief Período de la repetición automática */
+#ifndef GESTURE_REPEAT_MS
+#define GESTURE_REPEAT_MS 150
+#endif
+
+/** @brief Repeticiones en cada nivel de aceleración antes de pasar al siguiente */
+#ifndef GESTURE_ACCEL_REPEATS
+#define GESTURE_ACCEL_REPEATS 5
+#endif
+
+/** @brief Valor de GestureDeadline cuando no hay ningún evento programado */
+#define GESTURE_NO_DEADLINE UINT32_MAX
+
+/* === Public data type declarations =============================================================================== */
+
+/**
+ * @brief Tipo de gesto detectado.
+ */
+
+typedef enum {
+    GESTURE_PRESS,      //!< La tecla se presionó (o se tocó, si es parte de un acorde)
+    GESTURE_LONG_PRESS, //!< La tecla se mantuvo presionada GESTURE_LONG_PRESS_MS
+    GESTURE_REPEAT,     //!< Repetición automática de una tecla mantenida
+    GESTURE_CHORD,      //!< Todas las teclas de un acorde quedaron presionadas juntas
+} gesture_kind_t;
+
+/**
+ * @brief Evento generado por el detector.
+ */
+
+typedef struct {
+    gesture_kind_t kind; //!< Tipo de gesto
+    uint8_t key;         //!< Tecla, o índice del acorde para GESTURE_CHORD
+    uint8_t steps;       //!< Pasos que representa el evento: 1 salvo en las repeticiones
+} gesture_event_t;
+
+/**
+ * @brief Estado del detector de gestos.
+ */
+
+typedef struct {
+    uint32_t repeat_keys;                  //!< Teclas con repetición automática
+    uint32_t long_press_keys;              //!< Teclas que informan la pulsación larga
+    uint32_t chords[GESTURE_MAX_CHORDS];   //!< Máscara de teclas de cada acorde
+    uint8_t chord_count;                   //!< Cantidad de acordes
+    uint32_t chord_keys;                   //!< Unión de las teclas de todos los acordes
+    uint32_t held;                         //!< Teclas presionadas
+    uint32_t pending;                      //!< Teclas presionadas cuyo evento se retiene esperando un acorde
+    uint32_t consumed;                     //!< Teclas usadas por un acorde, ignoradas hasta soltarlas
+    uint32_t long_done;                    //!< Teclas que ya pasaron la pulsación larga
+    uint32_t pressed_at[GESTURE_MAX_KEYS]; //!< Momento en que se presionó cada tecla
+    uint32_t next_repeat[GESTURE_MAX_KEYS];//!< Momento de la próxima repetición de cada tecla
+    uint16_t repeats[GESTURE_MAX_KEYS];    //!< Repeticiones de cada tecla desde que se presionó
+} gesture_t;
+
+/* === Public variable declarations ================================================================================ */
+
+/* === Public function declarations ================================================================================ */
+
+/**
+ * @brief Inicializa el detector.
+ *
+ * @param self Detector de gestos.
+ * @param repeat_keys Teclas con repetición automática.
+ * @param long_press_keys Teclas que informan la pulsación larga (las que repiten no la informan).
+ */
+
+void GestureInit(gesture_t * self, uint32_t repeat_keys, uint32_t long_press_keys);
+
+/**
+ * @brief Agrega un acorde.
+ *
+ * @param self Detector de gestos.
+ * @param keys Teclas que forman el acorde (al menos dos).
+ * @return false si no hay lugar o el acorde tiene menos de dos teclas.
+ */
+
+bool GestureAddChord(gesture_t * self, uint32_t keys);
+
+/**
+ * @brief Procesa el estado filtrado de las teclas.
+ *
+ * @param self Detector de gestos.
+ * @param state Teclas presionadas, un bit por tecla.
+ * @param now Tiempo actual en milisegundos.
+ * @param events Donde se copian los eventos generados.
+ * @param size Capacidad de events.
+ * @return Cantidad de eventos generados.
+ */
+
+uint8_t GestureUpdate(gesture_t * self, uint32_t state, uint32_t now, gesture_event_t * events, uint8_t size);
+
+/**
+ * @brief Indica cuándo hay que volver a llamar a GestureUpdate aunque las teclas no cambien.
+ *
+ * @param self Detector de gestos.
+ * @param now Tiempo actual en milisegundos.
+ * @return Milisegundos hasta el próximo evento programado, o GESTURE_NO_DEADLINE si no hay ninguno.
+ */
+
+uint32_t GestureDeadline(const gesture_t * self, uint32_t now);
+
+/* === End of conditional blocks =================================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* GESTURE_H_ */
@@ -0,0 +1,126 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Roldan JesusAlejandro <kechuroldanjesus@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+#ifndef KEY_EDGES_H_
+#define KEY_EDGES_H_
+
+/** @file key_edges.h
+ ** @brief Cola de flancos de las teclas con su marca de tiempo, de la interrupción a la tarea de botones.
+ *
+ * Tiene un solo productor (las interrupciones de las teclas, todas con la misma prioridad, así que no se anidan) y
+ * un solo consumidor (la tarea de botones), por lo que no necesita tomar ningún mutex ni deshabilitar interrupciones.
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/* === Header for C++ compatibility ================================================================================ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions =================================================================================== */
+
+/** @brief Cantidad de flancos que se pueden acumular sin leer; debe ser una potencia de dos */
+#ifndef KEY_EDGES_CAPACITY
+#define KEY_EDGES_CAPACITY 16
+#endif
+
+/* === Public data type declarations =============================================================================== */
+
+/**
+ * @brief Flanco de una tecla.
+ */
+
+typedef struct {
+    uint32_t timestamp; //!< Tick del sistema en que ocurrió
+    uint8_t key;        //!< Índice de la tecla
+    bool active;        //!< Estado de la tecla después del flanco
+} key_edge_t;
+
+/**
+ * @brief Cola circular de flancos.
+ */
+
+typedef struct {
+    key_edge_t buffer[KEY_EDGES_CAPACITY];
+    volatile uint16_t head; //!< Lo avanza solo el productor
+    volatile uint16_t tail; //!< Lo avanza solo el consumidor
+    uint16_t overruns;      //!< Flancos descartados porque la cola estaba llena
+    uint32_t drained;       //!< Flancos atendidos con KeyEdgesDrain
+    uint32_t max_latency;   //!< Mayor demora entre un flanco y su atención, en ticks
+} key_edges_t;
+
+/* === Public variable declarations ================================================================================ */
+
+/* === Public function declarations ================================================================================ */
+
+/**
+ * @brief Vacía la cola.
+ *
+ * @param self Cola de flancos.
+ */
+
+void KeyEdgesInit(key_edges_t * self);
+
+/**
+ * @brief Agrega un flanco a la cola. Se llama desde la interrupción de las teclas.
+ *
+ * @param self Cola de flancos.
+ * @param key Índice de la tecla.
+ * @param active Estado de la tecla después del flanco.
+ * @param timestamp Tick del sistema en que ocurrió.
+ * @return false si la cola estaba llena y el flanco se descartó.
+ */
+
+bool KeyEdgesPush(key_edges_t * self, uint8_t key, bool active, uint32_t timestamp);
+
+/**
+ * @brief Saca el flanco más antiguo de la cola. Se llama desde la tarea de botones.
+ *
+ * @param self Cola de flancos.
+ * @param edge Donde se copia el flanco.
+ * @return false si la cola estaba vacía.
+ */
+
+bool KeyEdgesPop(key_edges_t * self, key_edge_t * edge);
+
+/**
+ * @brief Saca todos los flancos pendientes y registra cuánto tardó en atenderse cada uno.
+ *
+ * La tarea de botones toma el estado de las teclas de la muestra; los flancos le sirven para medir la demora entre
+ * la interrupción y el muestreo, que es lo que agrega el antirrebote a la respuesta de una tecla.
+ *
+ * @param self Cola de flancos.
+ * @param now Tick del sistema en que se atienden.
+ * @return Máscara de las teclas que tuvieron flancos, el bit n corresponde a la tecla n.
+ */
+
+uint32_t KeyEdgesDrain(key_edges_t * self, uint32_t now);
+
+/* === End of conditional blocks =================================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* KEY_EDGES_H_ */
@@ -0,0 +1,96 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Roldan JesusAlejandro <kechuroldanjesus@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+#ifndef LOW_POWER_H_
+#define LOW_POWER_H_
+
+/** @file low_power.h
+ ** @brief Modo de bajo consumo: el núcleo duerme sin tick durante los períodos ociosos (configUSE_TICKLESS_IDLE) y
+ * el reloj recupera al despertar todos los ticks que pasaron.
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include <stdint.h>
+#include "timebase.h"
+
+/* === Header for C++ compatibility ================================================================================ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions =================================================================================== */
+
+/* === Public data type declarations =============================================================================== */
+
+/**
+ * @brief Tiempo que el procesador pasó dormido, medido en ticks de la base de tiempo del reloj.
+ */
+
+typedef struct {
+    uint32_t sleeps;       //!< Veces que el procesador entró en reposo
+    uint32_t asleep_ticks; //!< Ticks del reloj que transcurrieron con el procesador dormido
+} low_power_stats_t;
+
+/* === Public variable declarations ================================================================================ */
+
+/** @brief Estadísticas de reposo, para inspeccionar en tiempo de ejecución */
+
+extern low_power_stats_t low_power_stats;
+
+/* === Public function declarations ================================================================================ */
+
+/**
+ * @brief Indica la base de tiempo que hay que suspender mientras el procesador duerme.
+ *
+ * @param timebase Base de tiempo del reloj, ya iniciada con ClockTaskStart.
+ */
+
+void LowPowerInit(timebase_driver_t timebase);
+
+/**
+ * @brief Prepara el reposo; FreeRTOS la llama con configPRE_SLEEP_PROCESSING antes de detener el procesador.
+ *
+ * @param expected_idle_ticks Ticks del sistema que se espera dormir.
+ */
+
+void LowPowerSleepEnter(uint32_t expected_idle_ticks);
+
+/**
+ * @brief Termina el reposo; FreeRTOS la llama con configPOST_SLEEP_PROCESSING al despertar.
+ *
+ * @param expected_idle_ticks Ticks del sistema que se esperaba dormir.
+ */
+
+void LowPowerSleepExit(uint32_t expected_idle_ticks);
+
+/**
+ * @brief Devuelve la fracción del tiempo que el procesador pasó dormido, en milésimos.
+ */
+
+uint32_t LowPowerResidency(void);
+
+/* === End of conditional blocks =================================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* LOW_POWER_H_ */
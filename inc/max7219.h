@@ -0,0 +1,125 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Roldan JesusAlejandro <kechuroldanjesus@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+#ifndef MAX7219_H_
+#define MAX7219_H_
+
+/** @file max7219.h
+ ** @brief Controlador de pantalla para controladores serie de siete segmentos tipo MAX7219, encadenados.
+ *
+ * Cada controlador multiplexa por su cuenta hasta ocho dígitos: el procesador solo le envía por un bus serie de tres
+ * líneas (datos, reloj y carga) los dígitos que cambiaron. Varios controladores se encadenan conectando la salida de
+ * datos de cada uno a la entrada del siguiente, y cada pulso de carga actualiza un registro en todos a la vez.
+ *
+ * El módulo se presenta a la pantalla como un controlador de `screen_driver_s` con WriteFrame, así que ScreenRefresh
+ * no escribe nada mientras la imagen y el parpadeo no cambien. Las funciones del controlador no reciben contexto,
+ * por lo que hay un solo bus de controladores serie por programa.
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "screen.h"
+#include <stdbool.h>
+#include <stdint.h>
+
+/* === Header for C++ compatibility ================================================================================ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions =================================================================================== */
+
+/** @brief Cantidad máxima de controladores encadenados */
+#ifndef MAX7219_MAX_CHIPS
+#define MAX7219_MAX_CHIPS 4
+#endif
+
+/** @brief Brillo de los controladores, de 0 a 15 */
+#ifndef MAX7219_INTENSITY
+#define MAX7219_INTENSITY 8
+#endif
+
+/** @brief Dígitos que multiplexa cada controlador como máximo */
+#define MAX7219_CHIP_DIGITS 8
+
+/* === Public data type declarations =============================================================================== */
+
+/**
+ * @brief Puntero a función que fija el nivel de una línea del bus serie
+ * @param high true para nivel alto
+ */
+
+typedef void (*max7219_line_t)(bool high);
+
+/**
+ * @brief Estructura que define las líneas del bus serie de los controladores
+ *
+ * Los datos se toman en el flanco ascendente del reloj, empezando por el bit más significativo, y el flanco
+ * ascendente de la carga copia en los registros lo que cada controlador recibió.
+ */
+
+typedef struct max7219_bus_s {
+    max7219_line_t Data;  /**< Función para fijar la línea de datos (DIN) */
+    max7219_line_t Clock; /**< Función para fijar la línea de reloj (CLK) */
+    max7219_line_t Load;  /**< Función para fijar la línea de carga (LOAD/CS) */
+} const * max7219_bus_t;
+
+/**
+ * @brief Tráfico enviado a los controladores, para medir el costo de la pantalla
+ */
+
+typedef struct {
+    uint32_t frames; //!< Imágenes recibidas de la pantalla
+    uint32_t loads;  //!< Pulsos de carga, cada uno actualiza un registro de todos los controladores
+    uint32_t bits;   //!< Bits enviados por la línea de datos
+} max7219_stats_t;
+
+/* === Public variable declarations ================================================================================ */
+
+/* === Public function declarations ================================================================================ */
+
+/**
+ * @brief Configura los controladores encadenados y devuelve el controlador de pantalla que los usa.
+ *
+ * Deja los controladores en funcionamiento normal, sin decodificación BCD, multiplexando digits_per_chip dígitos
+ * con brillo MAX7219_INTENSITY y con todos los dígitos apagados. El dígito 0 de la pantalla es el primero del
+ * controlador más cercano al procesador.
+ *
+ * @param bus Líneas del bus serie
+ * @param chips Cantidad de controladores encadenados, hasta MAX7219_MAX_CHIPS
+ * @param digits_per_chip Dígitos conectados a cada controlador, hasta MAX7219_CHIP_DIGITS
+ * @return Controlador para ScreenCreate, o NULL si los argumentos no son válidos
+ */
+
+screen_driver_t Max7219Create(max7219_bus_t bus, uint8_t chips, uint8_t digits_per_chip);
+
+/**
+ * @brief Devuelve el tráfico enviado desde Max7219Create.
+ */
+
+const max7219_stats_t * Max7219Stats(void);
+
+/* === End of conditional blocks =================================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* MAX7219_H_ */
@@ -29,6 +29,7 @@ SPDX-License-Identifier: MIT
 #include <stdbool.h>
 #include <stdint.h>
 #include "clock.h"
+#include "timebase.h"
 
 /* === Header for C++ compatibility ================================================================================ */
 
@@ -52,6 +53,32 @@ extern "C" {
 #define SEGMENT_G (1 << 6) //!< Segmento G
 #define SEGMENT_P (1 << 7) //!< Punto decimal
 
+/** @} */
+
+/** @brief Cantidad máxima de dígitos de una pantalla */
+#ifndef SCREEN_MAX_DIGITS
+#define SCREEN_MAX_DIGITS 8
+#endif
+
+/** @brief Cantidad de grupos de parpadeo independientes */
+#ifndef SCREEN_BLINK_GROUPS
+#define SCREEN_BLINK_GROUPS 4
+#endif
+
+/** @brief Posición de un diseño que queda apagada */
+#define SCREEN_LAYOUT_BLANK 0xFF
+
+/** @brief Grupo de parpadeo que usa DisplayFlashDigits */
+#define SCREEN_BLINK_DIGITS 0
+
+/** @brief Grupo de parpadeo que usa DisplayFlashPoints */
+#define SCREEN_BLINK_POINTS 1
+
+/** @brief Imágenes completas por segundo del multiplexado; el temporizador corre a este valor por los dígitos */
+#ifndef SCREEN_FRAME_RATE_HZ
+#define SCREEN_FRAME_RATE_HZ 100
+#endif
+
 /* === Public data type declarations =============================================================================== */
 
 /**
@@ -60,6 +87,29 @@ extern "C" {
 
 typedef struct ScreenS * ScreenT; 
 
+/**
+ * @brief Palabras de los puertos que muestran un dígito, calculadas al publicar la imagen.
+ *
+ * Los segmentos usan los bits SEGMENT_A a SEGMENT_G del puerto de segmentos; el punto y el dígito usan las palabras
+ * que indica el controlador en point_word y digit_words.
+ */
+
+typedef struct {
+    uint32_t segments; //!< Palabra del puerto de segmentos
+    uint32_t point;    //!< Palabra del puerto del punto decimal
+    uint32_t digit;    //!< Palabra del puerto de dígitos que enciende solo este dígito
+} screen_digit_frame_t;
+
+/**
+ * @brief Imagen completa de la pantalla: lo que el multiplexado muestra en cada dígito.
+ */
+
+typedef struct {
+    uint8_t segments[SCREEN_MAX_DIGITS];            //!< Segmentos encendidos de cada dígito
+    uint8_t points[SCREEN_MAX_DIGITS];              //!< SEGMENT_P si el punto decimal del dígito está encendido
+    screen_digit_frame_t words[SCREEN_MAX_DIGITS];  //!< Palabras de los puertos, las calcula ScreenSwapFrame
+} screen_frame_t;
+
 /**
  * @brief Puntero a función que apaga todos los dígitos del display
  */
@@ -81,18 +131,94 @@ typedef void (*segments_update_t)(uint8_t, uint8_t);
 
 typedef void (*digits_turn_on_t)(uint8_t); 
 
+/**
+ * @brief Puntero a función que apaga el dígito encendido y muestra otro con palabras ya calculadas
+ * @param frame Palabras de los puertos del dígito a mostrar
+ */
+
+typedef void (*digit_frame_write_t)(const screen_digit_frame_t * frame);
+
+/**
+ * @brief Puntero a función que envía una imagen completa a un controlador externo que multiplexa por su cuenta
+ * @param segments Segmentos de cada dígito, con SEGMENT_P si el punto está encendido
+ * @param digits Cantidad de dígitos de la pantalla
+ */
+
+typedef void (*frame_write_t)(const uint8_t segments[], uint8_t digits);
+
+/**
+ * @brief Puntero a función que lee un contador libre de microsegundos, para medir el tiempo encendido de cada dígito
+ * @return Cuenta actual en microsegundos
+ */
+
+typedef uint32_t (*screen_timestamp_t)(void);
+
 /**
  * @brief Estructura que define el controlador de hardware de la pantalla
+ *
+ * Si WriteDigitFrame no es NULL cada refresco es una sola llamada con las palabras calculadas al publicar la imagen,
+ * y DigitsTurnOff, SegmentsUpdate y DigitsTurnOn no se usan.
+ *
+ * Si WriteFrame no es NULL la pantalla la multiplexa un controlador externo: cada ScreenRefresh corresponde a una
+ * imagen completa y solo llama a WriteFrame si se publicó otra imagen o si el parpadeo cambió de mitad.
  */
 
 typedef struct screen_driver_s {
     digits_turn_off_t DigitsTurnOff;   /**< Función para apagar todos los dígitos */
     segments_update_t SegmentsUpdate; /**< Función para actualizar los segmentos de un dígito */
     digits_turn_on_t DigitsTurnOn;    /**< Función para encender un dígito específico */
+    digit_frame_write_t WriteDigitFrame; /**< Función para mostrar un dígito con sus palabras, o NULL */
+    const uint32_t * digit_words;        /**< Palabra del puerto de dígitos que enciende cada dígito */
+    uint32_t point_word;                 /**< Palabra del puerto del punto decimal con el punto encendido */
+    screen_timestamp_t Timestamp;        /**< Contador de microsegundos, o NULL para no medir el multiplexado */
+    frame_write_t WriteFrame;            /**< Función para enviar la imagen a un controlador externo, o NULL */
 } const * screen_driver_t;
 
+/**
+ * @brief Tiempo que queda encendido cada dígito con el multiplexado por interrupción, en microsegundos.
+ *
+ * La diferencia entre el máximo y el mínimo de un dígito es el jitter de su tiempo encendido.
+ */
+
+typedef struct {
+    uint32_t steps;                        //!< Interrupciones atendidas
+    uint32_t missed;                       //!< Períodos perdidos porque la interrupción llegó tarde
+    uint32_t on_min[SCREEN_MAX_DIGITS];    //!< Menor tiempo encendido de cada dígito
+    uint32_t on_max[SCREEN_MAX_DIGITS];    //!< Mayor tiempo encendido de cada dígito
+    uint32_t last;                         //!< Marca de tiempo del último paso
+} screen_refresh_stats_t;
+
+/**
+ * @brief Diseño de la pantalla: de qué valor BCD sale cada posición, empezando por el dígito 0 (el de la izquierda).
+ *
+ * Los índices apuntan al arreglo que recibe ScreenWriteLayout. Con clock_time_t.bcd el 0 son las unidades de
+ * segundos y el 5 las decenas de horas; un arreglo más largo, por ejemplo con la fecha a continuación de la hora,
+ * permite diseños de fecha y hora en ocho dígitos.
+ */
+
+typedef struct {
+    uint8_t size;                        //!< Posiciones que ocupa el diseño, igual a los dígitos de la pantalla
+    uint8_t fields[SCREEN_MAX_DIGITS];   //!< Índice del valor BCD de cada posición, o SCREEN_LAYOUT_BLANK
+} screen_layout_t;
+
 /* === Public variable declarations ================================================================================ */
 
+/** @brief HH:MM en cuatro dígitos, a partir de clock_time_t.bcd */
+extern const screen_layout_t SCREEN_LAYOUT_HHMM;
+
+/** @brief MM:SS en cuatro dígitos, a partir de clock_time_t.bcd */
+extern const screen_layout_t SCREEN_LAYOUT_MMSS;
+
+#if SCREEN_MAX_DIGITS >= 6
+/** @brief HH:MM:SS en seis dígitos, a partir de clock_time_t.bcd */
+extern const screen_layout_t SCREEN_LAYOUT_HHMMSS;
+#endif
+
+#if SCREEN_MAX_DIGITS >= 8
+/** @brief HH MM SS en ocho dígitos con una posición apagada entre campos, a partir de clock_time_t.bcd */
+extern const screen_layout_t SCREEN_LAYOUT_HH_MM_SS;
+#endif
+
 /* === Public function declarations ================================================================================ */
 
 
@@ -101,24 +227,95 @@ typedef struct screen_driver_s {
  *
  * @param digits Cantidad de dígitos de la pantalla
  * @param driver Controlador de hardware (funciones para manejar los dígitos y segmentos)
- * @return Objeto pantalla creado
+ * @return Objeto pantalla creado, o NULL si no hay controlador o falla la reserva de memoria
  */
 
 ScreenT ScreenCreate(uint8_t digits, screen_driver_t driver);
 
 /**
- * @brief Escribe valores BCD en los dígitos de la pantalla
+ * @brief Libera una pantalla; el multiplexado debe estar detenido.
  *
- * @param screen Pantalla a actualizar
- * @param value Vector de valores BCD a mostrar
- * @param size Tamaño del vector de valores
- * @param value_decimal_points Vector con información de puntos decimales encendidos (1) o apagados (0)
+ * @param self Pantalla a liberar (puede ser NULL)
  */
 
-void ScreenWriteBCD(ScreenT self, const clock_time_t * time, bool show_seconds, uint8_t decimal_points[]);
+void ScreenDestroy(ScreenT self);
 
 /**
- * @brief Actualiza la pantalla. Debe llamarse periódicamente (ej. en interrupción de SysTick)
+ * @brief Devuelve la imagen de trabajo, que el multiplexado no lee, para componer la próxima imagen.
+ *
+ * La pantalla tiene dos imágenes: la que se muestra y la de trabajo. Hay un solo productor: la imagen de trabajo
+ * se modifica solo entre ScreenBeginFrame y ScreenSwapFrame.
+ *
+ * @param self Pantalla a actualizar
+ * @return Imagen de trabajo, vacía
+ */
+
+screen_frame_t * ScreenBeginFrame(ScreenT self);
+
+/**
+ * @brief Publica la imagen de trabajo: desde el próximo ScreenRefresh se muestra en lugar de la anterior.
+ *
+ * Antes de publicarla calcula las palabras de los puertos de cada dígito, si el controlador las usa.
+ *
+ * El intercambio es la escritura de un solo byte, así que el multiplexado nunca ve una imagen a medio componer y no
+ * necesita ningún mutex.
+ *
+ * @param self Pantalla a actualizar
+ */
+
+void ScreenSwapFrame(ScreenT self);
+
+/**
+ * @brief Escribe dígitos BCD en la pantalla volviendo a codificar solo los que cambiaron.
+ *
+ * La pantalla recuerda los dígitos y los puntos de cada una de sus dos imágenes. Si coinciden con los de la imagen
+ * que se muestra no hace nada; si no, codifica en la imagen de trabajo solo los dígitos y puntos que difieren de
+ * lo que esa imagen ya tenía y la publica. Al volver al contenido anterior la imagen de trabajo ya lo tiene y se
+ * publica sin codificar nada.
+ *
+ * @param self Pantalla a actualizar
+ * @param bcd Valores BCD de cada dígito; un valor mayor que 9 apaga el dígito
+ * @param size Cantidad de valores; los dígitos siguientes se apagan
+ * @param points Máscara de puntos decimales encendidos, el bit 0 corresponde al dígito 0
+ * @return Cantidad de dígitos y puntos codificados
+ */
+
+uint8_t ScreenWriteDigits(ScreenT self, const uint8_t bcd[], uint8_t size, uint8_t points);
+
+/**
+ * @brief Compone una imagen ubicando los valores BCD según un diseño y la publica con ScreenWriteDigits.
+ *
+ * Compara primero contra lo último que se escribió con una sola operación, así que llamarla más seguido de lo que
+ * cambian los valores casi no cuesta nada.
+ *
+ * @param self Pantalla a actualizar
+ * @param layout Diseño que indica de qué valor sale cada posición; su tamaño debe ser el de la pantalla
+ * @param bcd Valores BCD a los que apuntan los índices del diseño
+ * @param points Máscara de puntos decimales encendidos, el bit 0 corresponde al dígito 0
+ * @return Cantidad de dígitos y puntos codificados; 0 si el diseño no coincide con la pantalla
+ */
+
+uint8_t ScreenWriteLayout(ScreenT self, const screen_layout_t * layout, const uint8_t bcd[], uint8_t points);
+
+/**
+ * @brief Muestra HH:MM o MM:SS en una pantalla de cuatro dígitos con ScreenWriteLayout, que no hace nada si no
+ * cambió
+ *
+ * @param self Pantalla a actualizar
+ * @param time Hora a mostrar
+ * @param show_seconds true para mostrar MM:SS en lugar de HH:MM
+ * @param decimal_points Vector con información de puntos decimales encendidos (1) o apagados (0)
+ * @return Cantidad de dígitos y puntos codificados
+ */
+
+uint8_t ScreenWriteBCD(ScreenT self, const clock_time_t * time, bool show_seconds, uint8_t decimal_points[]);
+
+/**
+ * @brief Muestra el dígito siguiente. Debe llamarse periódicamente, normalmente desde ScreenStart
+ *
+ * Con un controlador externo (WriteFrame) cada llamada es una imagen completa y no envía nada si no hubo cambios.
+ *
+ * Lee la imagen publicada sin tomar ningún bloqueo, por lo que puede correr en paralelo con el productor.
  *
  * @param screen Pantalla a refrescar
  */
@@ -126,25 +323,82 @@ void ScreenWriteBCD(ScreenT self, const clock_time_t * time, bool show_seconds,
 void ScreenRefresh(ScreenT screen);
 
 /**
- * @brief Controla el parpadeo de los dígitos dentro de un rango
+ * @brief Multiplexa la pantalla desde la interrupción de un temporizador, sin ninguna tarea.
+ *
+ * El temporizador llama a ScreenRefresh frame_rate veces por segundo por cada dígito, o frame_rate veces por
+ * segundo si el controlador tiene WriteFrame. La interrupción no usa funciones del sistema operativo ni bloqueos:
+ * lee la imagen publicada con ScreenSwapFrame, que no puede cambiar mientras la interrupción la muestra. La
+ * configuración del parpadeo sí la comparte con la interrupción, así que ScreenBlink se debe llamar con la
+ * interrupción enmascarada, por ejemplo dentro de una sección crítica.
+ *
+ * @param self Pantalla a multiplexar
+ * @param timer Temporizador que genera los pasos del multiplexado
+ * @param frame_rate Imágenes completas por segundo, por ejemplo SCREEN_FRAME_RATE_HZ
+ * @return true si el temporizador pudo generar la frecuencia pedida
+ */
+
+bool ScreenStart(ScreenT self, timebase_driver_t timer, uint16_t frame_rate);
+
+/**
+ * @brief Devuelve las mediciones del tiempo encendido de cada dígito, si el controlador tiene Timestamp.
+ *
+ * @param self Pantalla multiplexada con ScreenStart
+ * @return Mediciones acumuladas desde ScreenStart
+ */
+
+const screen_refresh_stats_t * ScreenRefreshStats(ScreenT self);
+
+/**
+ * @brief Calcula cuánto queda encendido cada dígito al multiplexar a una cantidad de imágenes por segundo.
+ *
+ * ScreenStart reparte cada imagen entre todos los dígitos: con más dígitos cada uno se enciende menos tiempo pero
+ * la misma cantidad de veces por segundo, sin parpadeo visible.
+ *
+ * @param self Pantalla a multiplexar
+ * @param frame_rate Imágenes completas por segundo
+ * @return Microsegundos encendido por dígito, o 0 si los argumentos no son válidos
+ */
+
+uint32_t ScreenOnTime(ScreenT self, uint16_t frame_rate);
+
+/**
+ * @brief Configura un grupo de parpadeo: los dígitos y puntos del grupo se ocultan durante la primera mitad de cada
+ * período y se muestran durante la segunda.
+ *
+ * Los grupos son independientes: un dígito se oculta si lo oculta cualquiera de ellos. Las máscaras de visibilidad
+ * se recalculan solo cuando algún grupo cambia de mitad, y el refresco las aplica sin comparar rangos.
+ *
+ * @param self Pantalla sobre la que se actúa
+ * @param group Grupo a configurar, menor que SCREEN_BLINK_GROUPS
+ * @param digits Máscara de dígitos del grupo, el bit 0 es el dígito 0
+ * @param points Máscara de puntos decimales del grupo
+ * @param period Imágenes completas que dura un ciclo oculto y visible, 0 para detener el grupo
+ * @param phase Imágenes del ciclo que se dan por transcurridas al empezar, para desfasar grupos del mismo período
+ * @return 0 si se configuró el grupo, -1 si los argumentos no son válidos
+ */
+
+int ScreenBlink(ScreenT self, uint8_t group, uint16_t digits, uint16_t points, uint16_t period, uint16_t phase);
+
+/**
+ * @brief Controla el parpadeo de los dígitos dentro de un rango, con el grupo SCREEN_BLINK_DIGITS
  *
  * @param display Pantalla sobre la que se actúa
  * @param from Índice inicial del rango
  * @param to Índice final del rango
- * @param divisor Factor de tiempo que define la velocidad del parpadeo
- * @return Estado del parpadeo (1: mostrar, 0: ocultar)
+ * @param divisor Imágenes completas que dura cada mitad del parpadeo, 0 para detenerlo
+ * @return 0 si se configuró el parpadeo, -1 si los argumentos no son válidos
  */
 
 int DisplayFlashDigits(ScreenT display, uint8_t from, uint8_t to, uint16_t divisor);
 
 /**
- * @brief Controla el parpadeo de los puntos decimales dentro de un rango
+ * @brief Controla el parpadeo de los puntos decimales dentro de un rango, con el grupo SCREEN_BLINK_POINTS
  *
  * @param display Pantalla sobre la que se actúa
  * @param from Índice inicial del rango
  * @param to Índice final del rango
- * @param divisor Factor de tiempo que define la velocidad del parpadeo
- * @return Estado del parpadeo (1: mostrar, 0: ocultar)
+ * @param divisor Imágenes completas que dura cada mitad del parpadeo, 0 para detenerlo
+ * @return 0 si se configuró el parpadeo, -1 si los argumentos no son válidos
  */
 
 int DisplayFlashPoints(ScreenT display, uint8_t from, uint8_t to, uint16_t divisor);
@@ -0,0 +1,103 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Roldan JesusAlejandro <kechuroldanjesus@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+#ifndef TASK_TIMING_H_
+#define TASK_TIMING_H_
+
+/** @file task_timing.h
+ ** @brief Instrumentación de tareas periódicas: histograma de jitter del período y deriva acumulada.
+ *
+ * Cada tarea periódica guarda un task_timing_t y lo actualiza al despertar con el contador de ticks del sistema.
+ * Una interrupción periódica puede usarlo igual con un contador más fino: la interrupción del multiplexado en bsp.c
+ * lo actualiza en cada paso con el contador de microsegundos de su temporizador (board_display_timing).
+ * La deriva es la diferencia entre el tiempo transcurrido y la cantidad de activaciones por el período: con un
+ * plazo absoluto (vTaskDelayUntil) se mantiene acotada, con un retardo relativo crece con cada demora.
+ *
+ * El módulo no depende de FreeRTOS, por lo que se puede probar en el host.
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include <stdint.h>
+
+/* === Header for C++ compatibility ================================================================================ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions =================================================================================== */
+
+/** @brief Cantidad de intervalos del histograma de jitter; el central corresponde a un período exacto */
+#ifndef TASK_TIMING_BINS
+#define TASK_TIMING_BINS 9
+#endif
+
+/* === Public data type declarations =============================================================================== */
+
+/**
+ * @brief Estadísticas de temporización de una tarea periódica, en ticks del sistema.
+ *
+ * histogram[TASK_TIMING_BINS / 2 + j] cuenta las activaciones separadas de la anterior por período + j ticks;
+ * los extremos acumulan todo lo que queda fuera del rango.
+ */
+
+typedef struct {
+    uint32_t period;                      //!< Período nominal de la tarea
+    uint32_t start;                       //!< Tick de referencia del plan de activaciones
+    uint32_t last;                        //!< Tick de la última activación
+    uint32_t activations;                 //!< Activaciones registradas desde la referencia
+    int32_t drift;                        //!< Atraso de la última activación respecto del plan
+    int32_t max_drift;                    //!< Mayor atraso observado
+    uint32_t histogram[TASK_TIMING_BINS]; //!< Histograma del jitter entre activaciones consecutivas
+} task_timing_t;
+
+/* === Public variable declarations ================================================================================ */
+
+/** @brief Cambios de contexto desde el arranque, contados por traceTASK_SWITCHED_IN en FreeRTOSConfig.h */
+extern volatile uint32_t task_timing_switches;
+
+/* === Public function declarations ================================================================================ */
+
+/**
+ * @brief Inicia las estadísticas de una tarea periódica.
+ *
+ * @param self Estadísticas a iniciar.
+ * @param now Tick en que empieza el plan de activaciones (el mismo que se le da a vTaskDelayUntil).
+ * @param period Período nominal en ticks.
+ */
+
+void TaskTimingInit(task_timing_t * self, uint32_t now, uint32_t period);
+
+/**
+ * @brief Registra una activación de la tarea.
+ *
+ * @param self Estadísticas de la tarea.
+ * @param now Tick en que la tarea despertó.
+ */
+
+void TaskTimingActivation(task_timing_t * self, uint32_t now);
+
+/* === End of conditional blocks =================================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* TASK_TIMING_H_ */
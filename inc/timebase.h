@@ -0,0 +1,111 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Roldan JesusAlejandro <kechuroldanjesus@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+#ifndef TIMEBASE_H_
+#define TIMEBASE_H_
+
+/** @file timebase.h
+ ** @brief Interfaz de las bases de tiempo que hacen avanzar el reloj.
+ *
+ * Una base de tiempo llama periódicamente a una función desde una interrupción. La placa ofrece dos
+ * implementaciones intercambiables (el tick de FreeRTOS y un temporizador del microcontrolador) y las pruebas usan
+ * una simulada en el host.
+ *
+ * Cada llamada informa cuántos períodos pasaron desde la anterior: normalmente uno, y más después de que la base de
+ * tiempo estuvo suspendida (por ejemplo mientras el procesador duerme), de modo que no se pierde ningún tick.
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/* === Header for C++ compatibility ================================================================================ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions =================================================================================== */
+
+/* === Public data type declarations =============================================================================== */
+
+/**
+ * @brief Función que la base de tiempo llama en cada período, desde el contexto de una interrupción
+ * @param ticks Períodos transcurridos desde la llamada anterior
+ * @param context Puntero entregado al iniciar la base de tiempo
+ */
+
+typedef void (*timebase_handler_t)(uint32_t ticks, void * context);
+
+/**
+ * @brief Puntero a función que inicia la base de tiempo
+ * @param frequency Cantidad de llamadas por segundo
+ * @param handler Función a llamar en cada período
+ * @param context Puntero que se entrega a la función
+ * @return true si la base de tiempo puede generar la frecuencia pedida y quedó en marcha
+ */
+
+typedef bool (*timebase_start_t)(uint32_t frequency, timebase_handler_t handler, void * context);
+
+/**
+ * @brief Puntero a función que detiene la base de tiempo
+ */
+
+typedef void (*timebase_stop_t)(void);
+
+/**
+ * @brief Puntero a función que deja de generar interrupciones sin dejar de contar el tiempo
+ */
+
+typedef void (*timebase_suspend_t)(void);
+
+/**
+ * @brief Puntero a función que vuelve a generar interrupciones después de una suspensión
+ *
+ * No llama a la función periódica, porque se puede llamar fuera de una interrupción (FreeRTOS la llama desde la
+ * tarea ociosa con configPOST_SLEEP_PROCESSING): los períodos atrasados los entrega la interrupción siguiente.
+ *
+ * @return Períodos completos que pasaron mientras estuvo suspendida, para las estadísticas de reposo
+ */
+
+typedef uint32_t (*timebase_resume_t)(void);
+
+/**
+ * @brief Estructura que define el controlador de una base de tiempo
+ */
+
+typedef struct timebase_driver_s {
+    timebase_start_t Start;     /**< Función para iniciar las llamadas periódicas */
+    timebase_stop_t Stop;       /**< Función para detenerlas */
+    timebase_suspend_t Suspend; /**< Función para suspenderlas mientras el procesador duerme */
+    timebase_resume_t Resume;   /**< Función para reanudarlas y recuperar los períodos perdidos */
+} const * timebase_driver_t;
+
+/* === Public variable declarations ================================================================================ */
+
+/* === Public function declarations ================================================================================ */
+
+/* === End of conditional blocks =================================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* TIMEBASE_H_ */
@@ -26,6 +26,8 @@ SPDX-License-Identifier: MIT
 
 #include "bsp.h"
 #include "chip.h"
+#include "FreeRTOS.h"
+#include "task.h"
 #include "screen.h"
 #include "poncho.h"
 #include <stdlib.h>
@@ -33,6 +35,32 @@ SPDX-License-Identifier: MIT
 
 /* === Macros definitions ========================================================================================== */
 
+// Con BOARD_TIMEBASE_TICK_HOOK el reloj avanza desde el tick de FreeRTOS; si no, desde un temporizador propio, lo
+// que permite bajar configTICK_RATE_HZ sin cambiar la frecuencia del reloj.
+#ifndef BOARD_TIMEBASE_TICK_HOOK
+#define TIMEBASE_TIMER       LPC_TIMER1
+#define TIMEBASE_TIMER_IRQ   TIMER1_IRQn
+#define TIMEBASE_TIMER_CLOCK CLK_MX_TIMER1
+#define TIMEBASE_TIMER_RESET RGU_TIMER1_RST
+#define TIMEBASE_MATCH       1
+#define TIMEBASE_TIMER_HZ    1000000u // El temporizador cuenta microsegundos, sin reiniciarse en cada período
+#endif
+
+// Cantidad de dígitos de la pantalla de la placa, según la tabla digit_words
+#define DISPLAY_DIGITS       (sizeof(digit_words) / sizeof(digit_words[0]))
+
+// El multiplexado de la pantalla usa otro temporizador, también contando microsegundos libremente
+#define DISPLAY_TIMER        LPC_TIMER2
+#define DISPLAY_TIMER_IRQ    TIMER2_IRQn
+#define DISPLAY_TIMER_CLOCK  CLK_MX_TIMER2
+#define DISPLAY_TIMER_RESET  RGU_TIMER2_RST
+#define DISPLAY_MATCH        0
+#define DISPLAY_TIMER_HZ     1000000u
+
+// El multiplexado no llama al sistema operativo, pero las secciones críticas de FreeRTOS lo tienen que enmascarar:
+// la máquina de estados cambia el parpadeo de la pantalla dentro de una
+#define DISPLAY_TIMER_PRIORITY configLIBRARY_MAX_SYSCALL_INTERRUPT_PRIORITY
+
 /* === Private data type declarations ============================================================================== */
 
 /* === Private function declarations =============================================================================== */
@@ -55,11 +83,31 @@ void SegmentsUpdate(uint8_t value, uint8_t value_decimal_points);
 /**
  * @brief Enciende el dígito especificado.
  * 
- * @param digit Número de dígito (0 a 3).
+ * @param digit Número de dígito, menor que DISPLAY_DIGITS.
  */
 
 void DigitsTurnOn(uint8_t digit);
 
+/**
+ * @brief Apaga el dígito encendido y muestra otro con las palabras de los puertos ya calculadas.
+ *
+ * @param frame Palabras de los puertos de segmentos, punto y dígitos.
+ */
+
+static void WriteDigitFrame(const screen_digit_frame_t * frame);
+
+/**
+ * @brief Lee el contador libre de microsegundos del temporizador del multiplexado.
+ */
+
+static uint32_t DisplayTimestamp(void);
+
+/**
+ * @brief Libera todo lo que BoardCreate alcanzó a crear; los campos que no se crearon deben ser NULL.
+ */
+
+static void BoardRelease(struct BoardS * self);
+
 /**
  * @brief Inicializa el LED RGB del color especificado.
  * 
@@ -69,17 +117,155 @@ void DigitsTurnOn(uint8_t digit);
 
 DigitalOutputT LedRGBInit(uint8_t color);
 
+#ifdef BOARD_TIMEBASE_TICK_HOOK
+/**
+ * @brief Inicia la base de tiempo del tick de FreeRTOS; solo acepta la frecuencia configTICK_RATE_HZ.
+ */
+
+static bool TickHookStart(uint32_t frequency, timebase_handler_t handler, void * context);
+
+/**
+ * @brief Detiene la base de tiempo del tick de FreeRTOS.
+ */
+
+static void TickHookStop(void);
+
+/**
+ * @brief No hace nada: FreeRTOS sigue contando los ticks mientras duerme.
+ */
+
+static void TickHookSuspend(void);
+
+/**
+ * @brief Informa los ticks dormidos del reposo anterior, sin entregarlos: llegan en la siguiente llamada a
+ * vApplicationTickHook.
+ *
+ * FreeRTOS suma los ticks dormidos a su cuenta después de configPOST_SLEEP_PROCESSING, así que recién el gancho del
+ * tick siguiente los ve; por eso cada reanudación informa los del reposo anterior.
+ */
+
+static uint32_t TickHookResume(void);
+#else
+/**
+ * @brief Inicia la base de tiempo del temporizador con la frecuencia indicada.
+ */
+
+static bool TimerStart(uint32_t frequency, timebase_handler_t handler, void * context);
+
+/**
+ * @brief Detiene la base de tiempo del temporizador.
+ */
+
+static void TimerStop(void);
+
+/**
+ * @brief Deshabilita la interrupción del temporizador, que sigue contando.
+ */
+
+static void TimerSuspend(void);
+
+/**
+ * @brief Vuelve a habilitar la interrupción y la deja pendiente si pasaron períodos mientras estuvo suspendido.
+ *
+ * No llama a la función periódica: FreeRTOS llama a Resume desde la tarea ociosa con las interrupciones
+ * deshabilitadas, y los períodos atrasados los entrega TIMER1_IRQHandler apenas se vuelvan a habilitar.
+ */
+
+static uint32_t TimerResume(void);
+
+/**
+ * @brief Cuenta los períodos cumplidos según el contador del temporizador y programa la siguiente coincidencia.
+ */
+
+static uint32_t TimerCatchUp(void);
+#endif
+
+/**
+ * @brief Inicia el temporizador del multiplexado con la frecuencia indicada.
+ */
+
+static bool DisplayTimerStart(uint32_t frequency, timebase_handler_t handler, void * context);
+
+/**
+ * @brief Detiene el temporizador del multiplexado.
+ */
+
+static void DisplayTimerStop(void);
+
+/**
+ * @brief No hace nada: la pantalla se sigue multiplexando mientras el procesador duerme.
+ */
+
+static void DisplayTimerSuspend(void);
+
+/**
+ * @brief No entrega nada: los pasos atrasados del multiplexado no se recuperan.
+ */
+
+static uint32_t DisplayTimerResume(void);
+
 /* === Private variable definitions ================================================================================ */
 
+/**
+ * @brief Palabra del puerto de dígitos de cada dígito: el dígito 0 de la pantalla es DIGIT_4. Una placa con más
+ * dígitos agrega sus máscaras aquí y en DIGITS_MASK.
+ */
+static const uint32_t digit_words[] = {DIGIT_4_MASK, DIGIT_3_MASK, DIGIT_2_MASK, DIGIT_1_MASK};
+
 static const struct screen_driver_s screen_driver = {
     .DigitsTurnOff = DigitsTurnOff,
     .SegmentsUpdate = SegmentsUpdate,
-    .DigitsTurnOn = DigitsTurnOn
+    .DigitsTurnOn = DigitsTurnOn,
+    .WriteDigitFrame = WriteDigitFrame,
+    .digit_words = digit_words,
+    .point_word = 1u << SEGMENT_P_BIT,
+    .Timestamp = DisplayTimestamp,
 };
 
+#ifdef BOARD_TIMEBASE_TICK_HOOK
+static const struct timebase_driver_s tick_hook_timebase = {
+    .Start = TickHookStart,
+    .Stop = TickHookStop,
+    .Suspend = TickHookSuspend,
+    .Resume = TickHookResume,
+};
+#else
+static const struct timebase_driver_s timer_timebase = {
+    .Start = TimerStart,
+    .Stop = TimerStop,
+    .Suspend = TimerSuspend,
+    .Resume = TimerResume,
+};
+#endif
+
+static const struct timebase_driver_s display_timer = {
+    .Start = DisplayTimerStart,
+    .Stop = DisplayTimerStop,
+    .Suspend = DisplayTimerSuspend,
+    .Resume = DisplayTimerResume,
+};
+
+#ifdef BOARD_TIMEBASE_TICK_HOOK
+static timebase_handler_t tick_hook_handler = NULL; /**< Función llamada desde vApplicationTickHook */
+static void * tick_hook_context = NULL;
+static TickType_t tick_hook_last = 0;               /**< Tick de FreeRTOS de la última llamada */
+static uint32_t tick_hook_slept = 0;                /**< Ticks que el gancho recibió juntos al volver del reposo */
+#else
+static timebase_handler_t timer_handler = NULL;     /**< Función llamada desde TIMER1_IRQHandler */
+static void * timer_context = NULL;
+static uint32_t timer_period = 0;                   /**< Cuentas del temporizador por período */
+static uint32_t timer_next_match = 0;               /**< Cuenta en que termina el período en curso */
+#endif
+static timebase_handler_t display_handler = NULL;   /**< Función llamada desde TIMER2_IRQHandler */
+static void * display_context = NULL;
+static uint32_t display_period = 0;                 /**< Microsegundos por paso del multiplexado */
+static uint32_t display_next_match = 0;             /**< Cuenta del próximo paso */
+
 
 /* === Public variable definitions ================================================================================= */
 
+task_timing_t board_display_timing;
+
 /* === Private function definitions ================================================================================ */
 
 /**
@@ -98,6 +284,9 @@ void DigitsInit(void) {
    
    Chip_SCU_PinMuxSet(DIGIT_4_PORT, DIGIT_4_PIN, SCU_MODE_INBUFF_EN | SCU_MODE_INACT | DIGIT_4_FUNC);
    DigitalOutputCreate(DIGIT_4_GPIO, DIGIT_4_BIT, false);
+
+   // Las escrituras enmascaradas (MPIN) solo tocan los pines de los dígitos
+   Chip_GPIO_SetPortMask(LPC_GPIO_PORT, DIGITS_GPIO, ~DIGITS_MASK);
 }
 
 /**
@@ -129,6 +318,10 @@ void SegmentsInit(void) {
    
    Chip_SCU_PinMuxSet(SEGMENT_P_PORT, SEGMENT_P_PIN, SCU_MODE_INBUFF_EN | SCU_MODE_INACT | SEGMENT_P_FUNC);
    DigitalOutputCreate(SEGMENT_P_GPIO, SEGMENT_P_BIT, false);
+
+   // Las escrituras enmascaradas (MPIN) solo tocan los pines de la pantalla; el resto de cada puerto queda igual
+   Chip_GPIO_SetPortMask(LPC_GPIO_PORT, SEGMENTS_GPIO, ~SEGMENTS_MASK);
+   Chip_GPIO_SetPortMask(LPC_GPIO_PORT, SEGMENT_P_GPIO, ~(1u << SEGMENT_P_BIT));
 }
 
 void DigitsTurnOff(void) {
@@ -148,10 +341,39 @@ void SegmentsUpdate(uint8_t value, uint8_t value_decimal_points) {
 
 void DigitsTurnOn(uint8_t digit) {
 
-   Chip_GPIO_SetValue(LPC_GPIO_PORT, DIGITS_GPIO, (1 << (3 - digit)) & DIGITS_MASK); // Prender el digito correspondiente
+   if (digit < DISPLAY_DIGITS) {
+      Chip_GPIO_SetValue(LPC_GPIO_PORT, DIGITS_GPIO, digit_words[digit]); // Prender el digito correspondiente
+   }
     
 }
 
+static void WriteDigitFrame(const screen_digit_frame_t * frame) {
+   // Entre apagar un dígito y encender el siguiente quedan solo las dos escrituras de segmentos y punto
+   Chip_GPIO_SetMaskedPortValue(LPC_GPIO_PORT, DIGITS_GPIO, 0);
+   Chip_GPIO_SetMaskedPortValue(LPC_GPIO_PORT, SEGMENTS_GPIO, frame->segments);
+   Chip_GPIO_SetMaskedPortValue(LPC_GPIO_PORT, SEGMENT_P_GPIO, frame->point);
+   Chip_GPIO_SetMaskedPortValue(LPC_GPIO_PORT, DIGITS_GPIO, frame->digit);
+}
+
+static uint32_t DisplayTimestamp(void) {
+   return Chip_TIMER_ReadCount(DISPLAY_TIMER);
+}
+
+static void BoardRelease(struct BoardS * self) {
+   DigitalInputGroupDestroy(self->keys);
+   DigitalInputDestroy(self->set_time);
+   DigitalInputDestroy(self->set_alarm);
+   DigitalInputDestroy(self->decrement);
+   DigitalInputDestroy(self->increment);
+   DigitalInputDestroy(self->accept);
+   DigitalInputDestroy(self->cancel);
+   DigitalOutputDestroy(self->led_red);
+   DigitalOutputDestroy(self->led_green);
+   DigitalOutputDestroy(self->led_blue);
+   ScreenDestroy(self->screen);
+   free(self);
+}
+
 
 DigitalOutputT LedRGBInit(uint8_t color) {
 
@@ -233,11 +455,203 @@ DigitalInputT DigitalInit(uint8_t Key) {
 }
 
 
+#ifdef BOARD_TIMEBASE_TICK_HOOK
+static bool TickHookStart(uint32_t frequency, timebase_handler_t handler, void * context) {
+    if (frequency != configTICK_RATE_HZ || handler == NULL) {
+        return false;
+    }
+    tick_hook_context = context;
+    tick_hook_last = xTaskGetTickCount();
+    tick_hook_handler = handler;
+    return true;
+}
+
+static void TickHookStop(void) {
+    tick_hook_handler = NULL;
+}
+
+static void TickHookSuspend(void) {
+}
+
+static uint32_t TickHookResume(void) {
+    uint32_t slept = tick_hook_slept;
+
+    tick_hook_slept = 0;
+    return slept;
+}
+#else
+
+static bool TimerStart(uint32_t frequency, timebase_handler_t handler, void * context) {
+    if (frequency == 0 || frequency > TIMEBASE_TIMER_HZ || handler == NULL) {
+        return false;
+    }
+    timer_handler = handler;
+    timer_context = context;
+
+    Chip_TIMER_Init(TIMEBASE_TIMER);
+    Chip_RGU_TriggerReset(TIMEBASE_TIMER_RESET);
+    while (Chip_RGU_InReset(TIMEBASE_TIMER_RESET)) {
+    }
+    Chip_TIMER_Reset(TIMEBASE_TIMER);
+    Chip_TIMER_PrescaleSet(TIMEBASE_TIMER, Chip_Clock_GetRate(TIMEBASE_TIMER_CLOCK) / TIMEBASE_TIMER_HZ - 1);
+
+    // El contador corre libre y la coincidencia avanza un período por vez, así el tiempo se sigue midiendo aunque
+    // la interrupción esté deshabilitada
+    timer_period = TIMEBASE_TIMER_HZ / frequency;
+    timer_next_match = timer_period;
+    Chip_TIMER_SetMatch(TIMEBASE_TIMER, TIMEBASE_MATCH, timer_next_match);
+    Chip_TIMER_MatchEnableInt(TIMEBASE_TIMER, TIMEBASE_MATCH);
+    Chip_TIMER_Enable(TIMEBASE_TIMER);
+
+    // La interrupción usa funciones FromISR de FreeRTOS, así que no puede tener más prioridad que la permitida
+    NVIC_SetPriority(TIMEBASE_TIMER_IRQ, configLIBRARY_MAX_SYSCALL_INTERRUPT_PRIORITY);
+    NVIC_ClearPendingIRQ(TIMEBASE_TIMER_IRQ);
+    NVIC_EnableIRQ(TIMEBASE_TIMER_IRQ);
+    return true;
+}
+
+static void TimerStop(void) {
+    NVIC_DisableIRQ(TIMEBASE_TIMER_IRQ);
+    Chip_TIMER_Disable(TIMEBASE_TIMER);
+    timer_handler = NULL;
+}
+
+static void TimerSuspend(void) {
+    Chip_TIMER_MatchDisableInt(TIMEBASE_TIMER, TIMEBASE_MATCH);
+}
+
+static uint32_t TimerResume(void) {
+    // Solo se cuentan los períodos vencidos; la coincidencia la reprograma la interrupción al entregarlos
+    uint32_t late = Chip_TIMER_ReadCount(TIMEBASE_TIMER) - timer_next_match;
+    uint32_t ticks = ((int32_t)late >= 0) ? late / timer_period + 1 : 0;
+
+    Chip_TIMER_MatchEnableInt(TIMEBASE_TIMER, TIMEBASE_MATCH);
+    if (ticks != 0) {
+        NVIC_SetPendingIRQ(TIMEBASE_TIMER_IRQ);
+    }
+    return ticks;
+}
+
+static uint32_t TimerCatchUp(void) {
+    uint32_t ticks = 0;
+    uint32_t late;
+
+    // Se repite si la cuenta pasó la nueva coincidencia antes de programarla, porque esa interrupción se perdería
+    while ((int32_t)(late = Chip_TIMER_ReadCount(TIMEBASE_TIMER) - timer_next_match) >= 0) {
+        uint32_t periods = late / timer_period + 1;
+        timer_next_match += periods * timer_period;
+        ticks += periods;
+        Chip_TIMER_SetMatch(TIMEBASE_TIMER, TIMEBASE_MATCH, timer_next_match);
+    }
+    return ticks;
+}
+#endif
+
+static bool DisplayTimerStart(uint32_t frequency, timebase_handler_t handler, void * context) {
+    if (frequency == 0 || frequency > DISPLAY_TIMER_HZ || handler == NULL) {
+        return false;
+    }
+    display_handler = handler;
+    display_context = context;
+
+    Chip_TIMER_Init(DISPLAY_TIMER);
+    Chip_RGU_TriggerReset(DISPLAY_TIMER_RESET);
+    while (Chip_RGU_InReset(DISPLAY_TIMER_RESET)) {
+    }
+    Chip_TIMER_Reset(DISPLAY_TIMER);
+    Chip_TIMER_PrescaleSet(DISPLAY_TIMER, Chip_Clock_GetRate(DISPLAY_TIMER_CLOCK) / DISPLAY_TIMER_HZ - 1);
+
+    // Contador libre: la coincidencia avanza un período por vez y el contador sirve para medir el tiempo encendido
+    display_period = DISPLAY_TIMER_HZ / frequency;
+    display_next_match = display_period;
+    TaskTimingInit(&board_display_timing, 0, display_period);
+    Chip_TIMER_SetMatch(DISPLAY_TIMER, DISPLAY_MATCH, display_next_match);
+    Chip_TIMER_MatchEnableInt(DISPLAY_TIMER, DISPLAY_MATCH);
+    Chip_TIMER_Enable(DISPLAY_TIMER);
+
+    NVIC_SetPriority(DISPLAY_TIMER_IRQ, DISPLAY_TIMER_PRIORITY);
+    NVIC_ClearPendingIRQ(DISPLAY_TIMER_IRQ);
+    NVIC_EnableIRQ(DISPLAY_TIMER_IRQ);
+    return true;
+}
+
+static void DisplayTimerStop(void) {
+    NVIC_DisableIRQ(DISPLAY_TIMER_IRQ);
+    Chip_TIMER_Disable(DISPLAY_TIMER);
+    display_handler = NULL;
+}
+
+static void DisplayTimerSuspend(void) {
+}
+
+static uint32_t DisplayTimerResume(void) {
+    return 0;
+}
+
 /* === Public function implementation ============================================================================== */
 
+#ifdef BOARD_TIMEBASE_TICK_HOOK
+/**
+ * @brief Función que FreeRTOS llama en cada tick del sistema (configUSE_TICK_HOOK).
+ */
+
+void vApplicationTickHook(void) {
+    if (tick_hook_handler != NULL) {
+        // Después de dormir sin tick FreeRTOS avanza su cuenta de una vez; la diferencia incluye esos ticks
+        TickType_t now = xTaskGetTickCountFromISR();
+        uint32_t ticks = now - tick_hook_last;
+        tick_hook_last = now;
+        if (ticks > 1) {
+            tick_hook_slept += ticks - 1;
+        }
+        tick_hook_handler(ticks, tick_hook_context);
+    }
+}
+#else
+
+/**
+ * @brief Interrupción del temporizador usado como base de tiempo.
+ *
+ * Además de la coincidencia, la deja pendiente TimerResume al volver del reposo: por eso no se consulta el flag de
+ * la coincidencia y TimerCatchUp cuenta los períodos vencidos según el contador.
+ */
+
+void TIMER1_IRQHandler(void) {
+    Chip_TIMER_ClearMatch(TIMEBASE_TIMER, TIMEBASE_MATCH);
+    uint32_t ticks = TimerCatchUp();
+    if (ticks != 0 && timer_handler != NULL) {
+        timer_handler(ticks, timer_context);
+    }
+}
+#endif
+
+/**
+ * @brief Interrupción del temporizador del multiplexado de la pantalla. No usa funciones de FreeRTOS.
+ */
+
+void TIMER2_IRQHandler(void) {
+    if (Chip_TIMER_MatchPending(DISPLAY_TIMER, DISPLAY_MATCH)) {
+        uint32_t ticks = 1;
+
+        Chip_TIMER_ClearMatch(DISPLAY_TIMER, DISPLAY_MATCH);
+        TaskTimingActivation(&board_display_timing, Chip_TIMER_ReadCount(DISPLAY_TIMER));
+        display_next_match += display_period;
+        // Si la interrupción se atrasó más de un período, la coincidencia pasaría de largo hasta que el contador
+        // dé toda la vuelta: se programa la siguiente que todavía no pasó
+        while ((int32_t)(Chip_TIMER_ReadCount(DISPLAY_TIMER) - display_next_match) >= 0) {
+            display_next_match += display_period;
+            ticks++;
+        }
+        Chip_TIMER_SetMatch(DISPLAY_TIMER, DISPLAY_MATCH, display_next_match);
+        if (display_handler != NULL) {
+            display_handler(ticks, display_context);
+        }
+    }
+}
+
 /*@brief implementacion de una board
  * @param self puntero a la estructura de la placa
- * @return puntero a la estructura de la placa
+ * @return puntero a la estructura de la placa, o NULL si no se pudo reservar la placa o el grupo de teclas
  * @details Crea un objeto de tipo BoardT y lo inicializa con los pines correspondientes a los leds y botones.
  * @note Se utiliza la libreria Chip_SCU_PinMuxSet para configurar los pines.
  * @note Se utiliza la libreria DigitalOutputCreate para crear los objetos de salida.
@@ -250,7 +664,8 @@ struct BoardS * self = malloc(sizeof(struct BoardS));
    if (self != NULL) {
       DigitsInit(); // Inicializar los pines de los digitos
       SegmentsInit(); // Inicializar los pines de los segmentos
-      self->screen = ScreenCreate(4, &screen_driver);
+      self->screen = ScreenCreate(DISPLAY_DIGITS, &screen_driver);
+      self->display_timer = &display_timer;
 
       self->led_red = LedRGBInit(1); // Inicializar el led rojo
       self->led_green = LedRGBInit(2); // Inicializar el led verde
@@ -262,26 +677,31 @@ struct BoardS * self = malloc(sizeof(struct BoardS));
       self->increment = DigitalInit(4); // Inicializar el boton Increment
       self->accept = DigitalInit(5); // Inicializar el boton Aceptar
       self->cancel = DigitalInit(6); // Inicializar el boton Cancelar
-      }
 
-      return self;
-}
-
-void SysTickInit(uint32_t ticks) {
-   // Deshabilita interrupciones globales
-    __asm volatile ("cpsid i");
-
-    // Actualiza la variable SystemCoreClock según la frecuencia del sistema
-    SystemCoreClockUpdate();
+      // Grupo con las teclas en el orden de board_key_t, para leer cada puerto una sola vez por barrido
+      self->keys = DigitalInputGroupCreate();
 
-    // Configura el SysTick para interrumpir cada "ticks" ciclos del reloj del sistema
-    SysTick_Config(SystemCoreClock / ticks);
-
-    // Establece la prioridad de la interrupción del SysTick (menor número = mayor prioridad)
-    NVIC_SetPriority(SysTick_IRQn, (1 << __NVIC_PRIO_BITS) - 1);
+      // Sin cualquiera de estos objetos la placa no se puede usar: se libera lo que se haya creado
+      if (!self->screen || !self->led_red || !self->led_green || !self->led_blue || !self->set_time ||
+          !self->set_alarm || !self->decrement || !self->increment || !self->accept || !self->cancel || !self->keys) {
+         BoardRelease(self);
+         return NULL;
+      }
+      DigitalInputGroupAdd(self->keys, self->set_time);
+      DigitalInputGroupAdd(self->keys, self->set_alarm);
+      DigitalInputGroupAdd(self->keys, self->decrement);
+      DigitalInputGroupAdd(self->keys, self->increment);
+      DigitalInputGroupAdd(self->keys, self->accept);
+      DigitalInputGroupAdd(self->keys, self->cancel);
+
+#ifdef BOARD_TIMEBASE_TICK_HOOK
+      self->timebase = &tick_hook_timebase;
+#else
+      self->timebase = &timer_timebase;
+#endif
+      }
 
-    // Habilita las interrupciones globales
-    __asm volatile ("cpsie i");
+      return self;
 }
 
 /* === End of documentation ======================================================================================== */
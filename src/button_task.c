@@ -17,21 +17,38 @@ OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
 SPDX-License-Identifier: MIT
 *********************************************************************************************************************/
 
-/** @file screen.c
- ** @brief implemntacion del modulo para la gestion de una pantalla multplexada de 7 segmentos
+/** @file button_task.c
+ ** @brief Tarea de botones: despierta con los flancos de las teclas, filtra los rebotes, reconoce los gestos y envía
+ ** los eventos al bus, agrupando los de ajuste.
  **/
 
 /* === Headers files inclusions ==================================================================================== */
 
 #include "button_task.h"
 #include "digital.h"
+#include "debounce.h"
+#include "event_bus.h"
+#include "gesture.h"
+#include "key_edges.h"
 #include "FreeRTOS.h"
 #include "task.h"
 
 
 /* === Macros definitions ========================================================================================== */
 
+/** @brief Período de muestreo de las teclas mientras hay cambios; el antirrebote dura DEBOUNCE_SAMPLES períodos */
+#define BUTTON_SCAN_MS 5
 
+/** @brief Espera máxima por lugar en la cola de teclas antes de descartar un evento (y contarlo en key_overruns) */
+#ifndef BUTTON_SEND_WAIT_MS
+#define BUTTON_SEND_WAIT_MS 50
+#endif
+
+/**
+ * @brief Convierte milisegundos a ticks redondeando hacia arriba: con el tick de 100 Hz de la base de tiempo del
+ * temporizador pdMS_TO_TICKS daría cero ticks para el período de muestreo y para los plazos cortos de los gestos.
+ */
+#define BUTTON_MS_TO_TICKS(ms) ((TickType_t)(((uint32_t)(ms) * configTICK_RATE_HZ + 999u) / 1000u))
 
 /* === Private data type declarations ============================================================================== */
 
@@ -39,59 +56,168 @@ SPDX-License-Identifier: MIT
 /* === Private function declarations =============================================================================== */
 
 static BoardT s_board;
-static QueueHandle_t s_evtQueue;
 
 /* === Private variable definitions ================================================================================ */
 
+// Teclas en el orden de board_key_t, cada una con su evento y con el canal de interrupción igual a su índice
+static DigitalInputT s_keys[BOARD_KEYS];
+static const event_t s_key_events[BOARD_KEYS] = {
+    [BOARD_KEY_SET_TIME] = EV_SET_TIME,  [BOARD_KEY_SET_ALARM] = EV_SET_ALARM, [BOARD_KEY_DECREMENT] = EV_ADJUST,
+    [BOARD_KEY_INCREMENT] = EV_ADJUST,   [BOARD_KEY_ACCEPT] = EV_ACCEPT,       [BOARD_KEY_CANCEL] = EV_CANCEL,
+};
+// Sentido de cada paso de las teclas que generan EV_ADJUST
+static const int8_t s_key_direction[BOARD_KEYS] = {
+    [BOARD_KEY_DECREMENT] = -1,
+    [BOARD_KEY_INCREMENT] = 1,
+};
+
+static key_edges_t s_edges;
+static debounce_t s_debounce;
+static gesture_t s_gestures;
+static int16_t s_adjust; // Pasos de EV_ADJUST acumulados que todavía no entraron en la cola
+static TaskHandle_t s_button_task;
+
 /* === Public variable definitions ================================================================================= */
 
 /* === Private function definitions ================================================================================ */
 
 static void vButtonTask(void *pvParameters);
 
+/**
+ * @brief Acumula los pasos de un ajuste, sin pasarse del rango de delta.
+ */
+
+static void ButtonAccumulate(int16_t delta);
+
+/**
+ * @brief Envía los pasos acumulados como un único evento EV_ADJUST.
+ *
+ * @param wait Tiempo máximo a esperar lugar en la cola.
+ * @return true si no quedan pasos pendientes.
+ */
+
+static bool ButtonFlushAdjust(TickType_t wait);
+
+/**
+ * @brief Atiende la interrupción de una tecla: encola el flanco con su tick y despierta a la tarea de botones.
+ */
+
+static void KeyEdgeISR(DigitalInputT input, bool active, void * context) {
+    BaseType_t woken = pdFALSE;
+    (void)context;
+
+    for (uint8_t key = 0; key < BOARD_KEYS; key++) {
+        if (s_keys[key] == input) {
+            KeyEdgesPush(&s_edges, key, active, xTaskGetTickCountFromISR());
+            break;
+        }
+    }
+    vTaskNotifyGiveFromISR(s_button_task, &woken);
+    portYIELD_FROM_ISR(woken);
+}
+
+static void ButtonAccumulate(int16_t delta) {
+    int32_t total = (int32_t)s_adjust + delta;
+
+    if (total > INT16_MAX) {
+        total = INT16_MAX;
+    } else if (total < INT16_MIN) {
+        total = INT16_MIN;
+    }
+    s_adjust = (int16_t)total;
+}
+
+static bool ButtonFlushAdjust(TickType_t wait) {
+    app_event_t ev = {.type = EV_ADJUST, .delta = s_adjust, .long_press = false};
+
+    if (s_adjust != 0) {
+        if (!EventBusSendKey(&ev, wait)) {
+            return false;
+        }
+        s_adjust = 0;
+    }
+    return true;
+}
+
 /* === Public function implementation ============================================================================== */
 
-void ButtonTaskInit(BoardT board, QueueHandle_t xEvtQueue) {
+const key_edges_t * ButtonTaskEdges(void) {
+    return &s_edges;
+}
+
+void ButtonTaskInit(BoardT board) {
     s_board = board;
-    s_evtQueue = xEvtQueue;
 
-    // Crear la tarea de FreeRTOS
-    xTaskCreate(vButtonTask, "Buttons", configMINIMAL_STACK_SIZE, NULL, tskIDLE_PRIORITY + 3, NULL);
+    s_keys[BOARD_KEY_SET_TIME] = board->set_time;
+    s_keys[BOARD_KEY_SET_ALARM] = board->set_alarm;
+    s_keys[BOARD_KEY_DECREMENT] = board->decrement;
+    s_keys[BOARD_KEY_INCREMENT] = board->increment;
+    s_keys[BOARD_KEY_ACCEPT] = board->accept;
+    s_keys[BOARD_KEY_CANCEL] = board->cancel;
+    KeyEdgesInit(&s_edges);
+    DebounceInit(&s_debounce, DigitalInputGroupScan(board->keys));
+
+    // Aumentar y disminuir repiten al mantenerlas y juntas forman el acorde que pone el valor en cero
+    GestureInit(&s_gestures, (1u << BOARD_KEY_INCREMENT) | (1u << BOARD_KEY_DECREMENT), 0);
+    GestureAddChord(&s_gestures, (1u << BOARD_KEY_INCREMENT) | (1u << BOARD_KEY_DECREMENT));
+
+    // Crear la tarea de FreeRTOS antes de habilitar las interrupciones que la notifican
+    BaseType_t created =
+        xTaskCreate(vButtonTask, "Buttons", configMINIMAL_STACK_SIZE, NULL, tskIDLE_PRIORITY + 3, &s_button_task);
+    configASSERT(created == pdPASS);
+    for (uint8_t key = 0; key < BOARD_KEYS; key++) {
+        DigitalInputEnableInterrupt(s_keys[key], key, KeyEdgeISR, NULL);
+    }
 }
 
 static void vButtonTask(void *pvParameters) {
-    const TickType_t debounce = pdMS_TO_TICKS(30);
+    const TickType_t period = BUTTON_MS_TO_TICKS(BUTTON_SCAN_MS);
+    TickType_t wait = portMAX_DELAY;
+    gesture_event_t gestures[BOARD_KEYS];
     app_event_t ev;
-    TickType_t last_input_tick __attribute__((unused)) = 0;
 
     for (;;) {
-        if (DigitalInputHasActivate(s_board->set_time)) {
-            ev.type = EV_SET_TIME; xQueueSend(s_evtQueue, &ev, 0);
-            last_input_tick = xTaskGetTickCount();
-            vTaskDelay(debounce);
-        } else if (DigitalInputHasActivate(s_board->set_alarm)) {
-            ev.type = EV_SET_ALARM; xQueueSend(s_evtQueue, &ev, 0);
-            last_input_tick = xTaskGetTickCount();
-            vTaskDelay(debounce);
-        } else if (DigitalInputHasActivate(s_board->accept)) {
-            ev.type = EV_ACCEPT; xQueueSend(s_evtQueue, &ev, 0);
-            last_input_tick = xTaskGetTickCount();
-            vTaskDelay(debounce);
-        } else if (DigitalInputHasActivate(s_board->cancel)) {
-            ev.type = EV_CANCEL; xQueueSend(s_evtQueue, &ev, 0);
-            last_input_tick = xTaskGetTickCount();
-            vTaskDelay(debounce);
-        } else if (DigitalInputHasActivate(s_board->increment)) {
-            ev.type = EV_INCREMENT; xQueueSend(s_evtQueue, &ev, 0);
-            last_input_tick = xTaskGetTickCount();
-            vTaskDelay(debounce);
-        } else if (DigitalInputHasActivate(s_board->decrement)) {
-            ev.type = EV_DECREMENT; xQueueSend(s_evtQueue, &ev, 0);
-            last_input_tick = xTaskGetTickCount();
-            vTaskDelay(debounce);
+        // La tarea duerme hasta que alguna tecla cambia o hasta el próximo gesto programado, como una repetición
+        ulTaskNotifyTake(pdTRUE, wait);
+
+        // Mientras alguna tecla no coincida con su estado filtrado se muestrean todas juntas cada período; ninguna
+        // muestra espera a las demás, así que se informan los gestos de todas las teclas
+        TickType_t last_scan = xTaskGetTickCount();
+        for (;;) {
+            // El estado se toma de la muestra; un flanco desde el muestreo anterior indica que la tecla todavía
+            // rebota, aunque el rebote haya sido más corto que el período y la muestra no lo vea
+            uint32_t bouncing = KeyEdgesDrain(&s_edges, xTaskGetTickCount());
+
+            uint32_t sample = DigitalInputGroupScan(s_board->keys);
+            debounce_edges_t edges = DebounceUpdate(&s_debounce, sample);
+            uint8_t count = GestureUpdate(&s_gestures, edges.state, xTaskGetTickCount() * portTICK_PERIOD_MS,
+                                          gestures, BOARD_KEYS);
+            for (uint8_t index = 0; index < count; index++) {
+                ev.type = (gestures[index].kind == GESTURE_CHORD) ? EV_CLEAR : s_key_events[gestures[index].key];
+                if (ev.type == EV_ADJUST) {
+                    // Las pulsaciones y repeticiones seguidas se suman en un solo evento
+                    ButtonAccumulate(s_key_direction[gestures[index].key] * gestures[index].steps);
+                    continue;
+                }
+                // Los pasos acumulados se aplican al campo que estaba en edición antes que este evento
+                ButtonFlushAdjust(portMAX_DELAY);
+                ev.delta = 0;
+                ev.long_press = (gestures[index].kind == GESTURE_LONG_PRESS);
+                // La máquina de estados tiene menor prioridad: esperar le da tiempo a vaciar la cola en lugar de
+                // perder la tecla
+                EventBusSendKey(&ev, pdMS_TO_TICKS(BUTTON_SEND_WAIT_MS));
+            }
+            // Si la cola está llena los pasos quedan acumulados y se reintenta en el próximo muestreo
+            bool flushed = ButtonFlushAdjust(0);
+
+            if (flushed && bouncing == 0 && DebouncePending(&s_debounce, sample) == 0) {
+                break;
+            }
+            vTaskDelayUntil(&last_scan, period);
         }
 
-        vTaskDelay(pdMS_TO_TICKS(2));
+        uint32_t deadline = GestureDeadline(&s_gestures, xTaskGetTickCount() * portTICK_PERIOD_MS);
+        wait = (deadline == GESTURE_NO_DEADLINE) ? portMAX_DELAY : BUTTON_MS_TO_TICKS(deadline);
     }
 }
 
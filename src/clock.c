@@ -18,17 +18,20 @@ SPDX-License-Identifier: MIT
 *********************************************************************************************************************/
 
 /** @file clock.c
- ** @brief Implementación de una biblioteca de reloj digital con alarma basada en TDD.
+ ** @brief Implementación de una biblioteca de reloj digital con alarmas basada en TDD.
  *
- * Este módulo implementa un reloj digital que mantiene la hora en formato BCD y gestiona una alarma configurable.
- * La hora avanza en función de "ticks" de reloj simulados. La biblioteca está diseñada para ser utilizada
- * en entornos embebidos y es testeable con frameworks como Unity.
+ * Cada reloj sale de un pool estático de CLOCK_MAX_INSTANCES y mantiene la hora como segundos desde la medianoche y
+ * como una palabra BCD empaquetada que se incrementa sin desempaquetar. Cada cambio de segundo publica la palabra en
+ * una instantánea protegida por un contador de secuencia, de la que cualquier tarea o interrupción puede leer sin
+ * tomar un mutex. La hora avanza con los ticks de una base de tiempo, de a uno (ClockNewTick) o de a muchos en
+ * tiempo constante (ClockAdvanceTicks). La biblioteca no depende del hardware y se prueba en el host con Unity.
  *
  * Las funcionalidades principales incluyen:
- * - Mantenimiento de hora actual con precisión de segundos.
  * - Ajuste y lectura de la hora actual.
- * - Ajuste, lectura, habilitación, deshabilitación y comparación de la hora de alarma.
- * - Posposición de la alarma una cantidad arbitraria de minutos.
+ * - Hasta CLOCK_MAX_ALARMS alarmas por reloj, con una cuenta regresiva hasta la próxima en lugar de comparar en cada
+ *   tick.
+ * - Posposición de una alarma y cancelación por el día.
+ * - Observadores de los cambios de segundo, minuto, hora y día.
  **/
 
 /* === Headers files inclusions ==================================================================================== */
@@ -37,61 +40,522 @@ SPDX-License-Identifier: MIT
 #include <string.h>
 /* === Macros definitions ========================================================================================== */
 
+#define SECONDS_PER_MINUTE 60u
+#define SECONDS_PER_HOUR   3600u
+#define SECONDS_PER_DAY    86400u
+
+// Sesgo por dígito de la palabra empaquetada: 16 menos la base de cada dígito (10, 6, 10, 6, 10, 10).
+// Al sumarlo, un dígito que llega a su base desborda el nibble y el acarreo pasa solo al siguiente.
+#define PACKED_BIAS        0x0066A6A6u
+#define PACKED_NIBBLE_LSB  0x00111111u  // Bit menos significativo de cada dígito
+#define PACKED_HOURS_MASK  0x00FF0000u
+#define PACKED_HOURS_LIMIT 0x00240000u  // Las 24 horas vuelven a 00
+
+// Barrera entre los accesos al contador de secuencia y a la instantánea. En un Cortex-M de un solo núcleo alcanza
+// con una barrera del compilador; la predeterminada es una barrera completa para que sirva también en el host.
+#ifndef CLOCK_MEMORY_BARRIER
+#define CLOCK_MEMORY_BARRIER() __sync_synchronize()
+#endif
+
 /* === Private data type declarations ============================================================================== */
 
+/**
+ * @brief Hora publicada para los lectores.
+ */
+
+typedef struct {
+    clock_packed_t time; // Hora en BCD empaquetado
+    bool is_valid;       // Copia de is_valid en el momento de publicar
+} clock_snapshot_t;
+
+/**
+ * @brief Estado de cada alarma de la tabla.
+ */
+
+typedef struct {
+    uint32_t seconds;         // Hora programada en segundos desde la medianoche
+    uint32_t snooze;          // Segundos pospuestos acumulados sobre la hora programada
+    clock_time_t view;        // Vista BCD de la hora efectiva, se arma solo cuando se pide
+    bool view_cached;         // true si view corresponde a seconds + snooze
+    bool active;              // Alarma habilitada
+    bool skipped_today;       // Cancelada para hoy, vuelve a sonar mañana
+} clock_alarm_t;
+
+/**
+ * @brief Observador registrado para los cambios de la hora.
+ */
+
+typedef struct {
+    clock_observer_t callback; // Función a llamar
+    void * context;            // Puntero que se le entrega a la función
+    uint8_t edges;             // Máscara de clock_edge_t de interés
+} clock_observer_entry_t;
+
 struct clock_s {
+    bool in_use;              // true si la instancia del pool está asignada
     uint16_t clock_ticks;     // Ticks por segundo (constante, lo pasa ClockCreate)
     uint16_t tick_counter;    // Contador interno de ticks acumulados
-    clock_time_t current_time;
+    uint32_t seconds;         // Hora actual en segundos desde la medianoche
+    clock_packed_t packed_time; // La misma hora en BCD empaquetado, se incrementa junto con seconds
     bool is_valid;
-
-    clock_time_t alarm_time;
-    bool alarm_active;
     bool init_mode;
-    bool alarm_ringing;
-    bool skippedToday;  // Nuevo: True = cancelada para hoy, suena mañana
+
+    clock_alarm_t alarms[CLOCK_MAX_ALARMS];
+    uint8_t alarm_order[CLOCK_MAX_ALARMS]; // Identificadores de alarma ordenados por minuto de disparo
+    uint8_t next_alarm;       // Posición en alarm_order de la próxima alarma a disparar
+    uint32_t seconds_to_alarm; // Cuenta regresiva hasta que la hora entre en el minuto de next_alarm
+    bool any_skipped;         // true si alguna alarma espera el rearmado de medianoche
+
+    clock_observer_entry_t observers[CLOCK_MAX_OBSERVERS];
+    uint8_t observer_count;   // Observadores registrados, al principio del arreglo
+
+    // Instantánea para los lectores: mientras el escritor modifica una copia, el bit menos significativo de
+    // sequence apunta a la otra, de modo que un lector nunca espera aunque interrumpa al escritor.
+    volatile uint32_t sequence;
+    clock_snapshot_t snapshot[2];
 };
 
 
 /* === Private function declarations =============================================================================== */
 
+/**
+ * @brief Convierte una hora en formato BCD a segundos desde la medianoche.
+ */
+
+static uint32_t BcdToSeconds(const clock_time_t * time);
+
+/**
+ * @brief Convierte segundos desde la medianoche a una hora en formato BCD.
+ */
+
+static void SecondsToBcd(uint32_t seconds, clock_time_t * time);
+
+/**
+ * @brief Obtiene el comienzo del minuto en que dispara una alarma, en segundos desde la medianoche.
+ */
+
+static uint32_t AlarmFireSecond(const clock_alarm_t * alarm);
+
+/**
+ * @brief Indica si los segundos recién alcanzados [first, last] cruzan el comienzo del minuto de la alarma.
+ *
+ * Como ClockNewTick, solo cuenta el flanco: un intervalo que empieza dentro del minuto de la alarma no la repite.
+ */
+
+static bool IntervalHitsAlarm(const clock_alarm_t * alarm, uint64_t first, uint64_t last);
+
+/**
+ * @brief Reordena el índice de alarmas por minuto de disparo y recalcula la cuenta regresiva.
+ */
+
+static void AlarmScheduleUpdate(clock_t self);
+
+/**
+ * @brief Recalcula la próxima alarma y la cuenta regresiva a partir de la hora actual.
+ */
+
+static void AlarmCountdownUpdate(clock_t self);
+
+/**
+ * @brief Dispara las alarmas de la cabeza del índice y avanza a la siguiente hora de disparo.
+ */
+
+static bool AlarmFireNext(clock_t self);
+
+/**
+ * @brief Devuelve la alarma con el identificador indicado, o NULL si no existe.
+ */
+
+static clock_alarm_t * AlarmGet(clock_t self, uint8_t id);
+
+/**
+ * @brief Calcula los flancos que produce llegar a la hora indicada desde el segundo anterior.
+ */
+
+static uint8_t EdgesAt(uint32_t seconds);
+
+/**
+ * @brief Llama a los observadores interesados en alguno de los flancos indicados.
+ */
+
+static void EdgesNotify(clock_t self, uint8_t edges);
+
+/**
+ * @brief Publica la hora actual en la instantánea que usan los lectores.
+ */
+
+static void TimePublish(clock_t self);
+
+/**
+ * @brief Recalcula la hora empaquetada a partir de los segundos y la publica.
+ */
+
+static void TimeRepublish(clock_t self);
+
 /* === Private variable definitions ================================================================================ */
 
+static struct clock_s instances[CLOCK_MAX_INSTANCES]; //! <- Pool estático de relojes, sin memoria dinámica
+
 /* === Public variable definitions ================================================================================= */
 
 /* === Private function definitions ================================================================================ */
 
+static uint32_t BcdToSeconds(const clock_time_t * time) {
+    uint32_t hours = time->time.hours[1] * 10u + time->time.hours[0];
+    uint32_t minutes = time->time.minutes[1] * 10u + time->time.minutes[0];
+    uint32_t seconds = time->time.seconds[1] * 10u + time->time.seconds[0];
+
+    return hours * SECONDS_PER_HOUR + minutes * SECONDS_PER_MINUTE + seconds;
+}
+
+static void SecondsToBcd(uint32_t seconds, clock_time_t * time) {
+    uint8_t hours = seconds / SECONDS_PER_HOUR;
+    uint8_t minutes = (seconds / SECONDS_PER_MINUTE) % 60u;
+
+    seconds = seconds % SECONDS_PER_MINUTE;
+
+    time->time.seconds[0] = seconds % 10;
+    time->time.seconds[1] = seconds / 10;
+    time->time.minutes[0] = minutes % 10;
+    time->time.minutes[1] = minutes / 10;
+    time->time.hours[0] = hours % 10;
+    time->time.hours[1] = hours / 10;
+}
+
+static uint32_t AlarmFireSecond(const clock_alarm_t * alarm) {
+    uint32_t effective = (alarm->seconds + alarm->snooze) % SECONDS_PER_DAY;
+    return effective - effective % SECONDS_PER_MINUTE;
+}
+
+static bool IntervalHitsAlarm(const clock_alarm_t * alarm, uint64_t first, uint64_t last) {
+    // Primer comienzo del minuto de la alarma que todavía no se alcanzó, hoy o mañana
+    uint64_t next_window = AlarmFireSecond(alarm);
+    if (first > next_window) {
+        next_window += SECONDS_PER_DAY;
+    }
+    return next_window <= last;
+}
+
+static void AlarmScheduleUpdate(clock_t self) {
+    // Ordenamiento por inserción: la tabla es chica y solo se reordena cuando cambia la hora de una alarma
+    for (uint8_t position = 1; position < CLOCK_MAX_ALARMS; position++) {
+        uint8_t id = self->alarm_order[position];
+        uint32_t fire = AlarmFireSecond(&self->alarms[id]);
+        uint8_t index = position;
+        while (index > 0 && AlarmFireSecond(&self->alarms[self->alarm_order[index - 1]]) > fire) {
+            self->alarm_order[index] = self->alarm_order[index - 1];
+            index--;
+        }
+        self->alarm_order[index] = id;
+    }
+    AlarmCountdownUpdate(self);
+}
+
+static void AlarmCountdownUpdate(clock_t self) {
+    uint32_t now = self->seconds % SECONDS_PER_DAY;
+    uint8_t position = 0;
+
+    // Primera alarma que dispara después de ahora; si ya pasaron todas, la primera de mañana
+    while (position < CLOCK_MAX_ALARMS && AlarmFireSecond(&self->alarms[self->alarm_order[position]]) <= now) {
+        position++;
+    }
+    if (position == CLOCK_MAX_ALARMS) {
+        position = 0;
+    }
+
+    uint32_t fire = AlarmFireSecond(&self->alarms[self->alarm_order[position]]);
+    self->next_alarm = position;
+    self->seconds_to_alarm = (fire + SECONDS_PER_DAY - now) % SECONDS_PER_DAY;
+    if (self->seconds_to_alarm == 0) {
+        self->seconds_to_alarm = SECONDS_PER_DAY;
+    }
+}
+
+static bool AlarmFireNext(clock_t self) {
+    uint8_t first = self->next_alarm;
+    uint8_t position = first;
+    uint32_t fire = AlarmFireSecond(&self->alarms[self->alarm_order[first]]);
+    bool fired = false;
+
+    // Todas las alarmas programadas para el mismo minuto están contiguas en el índice
+    do {
+        fired |= self->alarms[self->alarm_order[position]].active;
+        if (++position == CLOCK_MAX_ALARMS) {
+            position = 0;
+        }
+    } while (position != first && AlarmFireSecond(&self->alarms[self->alarm_order[position]]) == fire);
+
+    uint32_t next_fire = AlarmFireSecond(&self->alarms[self->alarm_order[position]]);
+    self->next_alarm = position;
+    self->seconds_to_alarm = (next_fire + SECONDS_PER_DAY - fire) % SECONDS_PER_DAY;
+    if (self->seconds_to_alarm == 0) {
+        self->seconds_to_alarm = SECONDS_PER_DAY;
+    }
+    return fired;
+}
+
+static clock_alarm_t * AlarmGet(clock_t self, uint8_t id) {
+    if (id >= CLOCK_MAX_ALARMS) {
+        return NULL;
+    }
+    return &self->alarms[id];
+}
+
+static uint8_t EdgesAt(uint32_t seconds) {
+    uint8_t edges = CLOCK_EDGE_SECOND;
+    if (seconds % SECONDS_PER_MINUTE == 0) {
+        edges |= CLOCK_EDGE_MINUTE;
+        if (seconds % SECONDS_PER_HOUR == 0) {
+            edges |= CLOCK_EDGE_HOUR;
+            if (seconds == 0) {
+                edges |= CLOCK_EDGE_DAY;
+            }
+        }
+    }
+    return edges;
+}
+
+static void TimePublish(clock_t self) {
+    clock_snapshot_t value = {.time = self->packed_time, .is_valid = self->is_valid};
+
+    self->sequence++; // Impar: los lectores usan snapshot[1]
+    CLOCK_MEMORY_BARRIER();
+    self->snapshot[0] = value;
+    CLOCK_MEMORY_BARRIER();
+    self->sequence++; // Par: los lectores usan snapshot[0]
+    CLOCK_MEMORY_BARRIER();
+    self->snapshot[1] = value;
+}
+
+static void TimeRepublish(clock_t self) {
+    clock_time_t time;
+    SecondsToBcd(self->seconds, &time);
+    self->packed_time = ClockTimePack(&time);
+    TimePublish(self);
+}
+
+static void EdgesNotify(clock_t self, uint8_t edges) {
+    for (uint8_t index = 0; index < self->observer_count; index++) {
+        clock_observer_entry_t * observer = &self->observers[index];
+        if (observer->edges & edges) {
+            observer->callback(self, edges, observer->context);
+        }
+    }
+}
+
 /* === Public function implementation ============================================================================== */
 
+/**
+ * @brief Empaqueta una hora BCD de 6 bytes en una palabra de 32 bits.
+ *
+ * El byte i de clock_time_t.bcd ocupa el nibble i, así que las unidades de segundos quedan en los bits menos
+ * significativos y los dos nibbles superiores quedan en cero.
+ *
+ * @param time Hora en formato BCD.
+ * @return clock_packed_t Hora empaquetada, un dígito por nibble.
+ */
+
+clock_packed_t ClockTimePack(const clock_time_t * time) {
+    clock_packed_t packed = 0;
+    for (uint8_t index = 0; index < sizeof(time->bcd); index++) {
+        packed |= (clock_packed_t)(time->bcd[index] & 0x0F) << (4 * index);
+    }
+    return packed;
+}
+
+/**
+ * @brief Desempaqueta una palabra de 32 bits en la hora BCD de 6 bytes, un nibble por byte.
+ *
+ * @param packed Hora empaquetada.
+ * @param time Puntero donde se almacenará la hora en formato BCD.
+ */
+
+void ClockTimeUnpack(clock_packed_t packed, clock_time_t * time) {
+    for (uint8_t index = 0; index < sizeof(time->bcd); index++) {
+        time->bcd[index] = (packed >> (4 * index)) & 0x0F;
+    }
+}
+
+/**
+ * @brief Suma un segundo a una hora empaquetada sin recorrer los dígitos uno por uno.
+ *
+ * Se suma 1 junto con un sesgo por dígito que hace que cada dígito en su límite desborde a su nibble vecino. Los
+ * acarreos se recuperan comparando la suma con los sumandos y a los dígitos que no desbordaron se les quita el sesgo.
+ * Solo falta volver de 24 a 00 en las horas, con UADD8 y SEL en el Cortex-M4 o con una comparación en el host.
+ *
+ * @param packed Hora empaquetada válida.
+ * @return clock_packed_t Hora empaquetada un segundo después.
+ */
+
+clock_packed_t ClockPackedIncrement(clock_packed_t packed) {
+    clock_packed_t addend = PACKED_BIAS + 1;
+    clock_packed_t sum = packed + addend;
+
+    // Bits donde entró un acarreo: el bit 4 * (i + 1) indica que el dígito i desbordó
+    clock_packed_t carries = (sum ^ packed ^ addend) >> 4;
+    // Los dígitos que no desbordaron conservan el sesgo y hay que quitárselo (sin préstamos, valen >= sesgo)
+    clock_packed_t kept = ~carries & PACKED_NIBBLE_LSB;
+    sum -= (kept * 0x0F) & PACKED_BIAS;
+
+#if defined(__ARM_FEATURE_DSP)
+    // Cortex-M4: UADD8 marca en GE[2] si el byte de horas llegó a 0x24 y SEL lo pone en cero sin saltos
+    clock_packed_t wrapped;
+    __asm__("uadd8 %0, %1, %2\n\t"
+            "sel %0, %3, %1"
+            : "=&r"(wrapped)
+            : "r"(sum), "r"(0x01000000u - PACKED_HOURS_LIMIT), "r"(0u)
+            : "cc");
+    sum = wrapped;
+#else
+    if ((sum & PACKED_HOURS_MASK) == PACKED_HOURS_LIMIT) {
+        sum &= ~PACKED_HOURS_MASK;
+    }
+#endif
+    return sum;
+}
+
+/**
+ * @brief Compara dos horas empaquetadas en los nibbles seleccionados con una sola operación XOR.
+ *
+ * @param first Primera hora empaquetada.
+ * @param second Segunda hora empaquetada.
+ * @param mask Nibbles a comparar, por ejemplo CLOCK_PACKED_MASK_HHMM.
+ * @return true si los nibbles seleccionados son iguales.
+ */
+
+bool ClockPackedMatch(clock_packed_t first, clock_packed_t second, clock_packed_t mask) {
+    return ((first ^ second) & mask) == 0;
+}
+
+/**
+ * @brief Suma un desplazamiento con signo a un campo BCD de dos dígitos, dando la vuelta en el módulo.
+ *
+ * El desplazamiento se reduce primero al módulo, así que basta una sola corrección hacia arriba o hacia abajo
+ * aunque lleguen muchos pasos acumulados de una vez.
+ *
+ * @param value Campo BCD de dos dígitos (unidades, decenas).
+ * @param delta Pasos a sumar, negativos para restar.
+ * @param modulo Cantidad de valores del campo: 24 para las horas, 60 para los minutos.
+ */
+
+void ClockBcdAdjust(uint8_t value[2], int16_t delta, uint8_t modulo) {
+    int16_t result = (int16_t)(value[1] * 10 + value[0]) + (delta % modulo);
+
+    if (result < 0) {
+        result += modulo;
+    } else if (result >= modulo) {
+        result -= modulo;
+    }
+    value[0] = result % 10;
+    value[1] = result / 10;
+}
+
 /**
  * @brief Crea una instancia de reloj con los ticks por segundo especificados.
  *
+ * La instancia se toma del pool estático de CLOCK_MAX_INSTANCES relojes.
+ *
  * @param ticks_per_second Número de ticks necesarios para que pase un segundo.
- * @return clock_t Instancia del reloj inicializado (hora inválida y alarma deshabilitada).
+ * @return clock_t Instancia del reloj inicializado (hora inválida y alarmas deshabilitadas), o NULL si no quedan
+ * instancias libres.
  */
 
 clock_t ClockCreate(uint16_t ticks_per_second) {
-    static struct clock_s self[1];
+    clock_t self = NULL;
+    for (uint8_t index = 0; index < CLOCK_MAX_INSTANCES; index++) {
+        if (!instances[index].in_use) {
+            self = &instances[index];
+            break;
+        }
+    }
+    if (self == NULL) {
+        return NULL;
+    }
+
     memset(self, 0, sizeof(struct clock_s));
+    self->in_use = true;
     self->is_valid = false;
-    self->alarm_active = false;
     self->clock_ticks = ticks_per_second;  
     self->tick_counter = 0;                
+    for (uint8_t id = 0; id < CLOCK_MAX_ALARMS; id++) {
+        self->alarms[id].view_cached = true;
+        self->alarm_order[id] = id;
+    }
+    AlarmCountdownUpdate(self);
     return self;
 }
 
+/**
+ * @brief Libera una instancia de reloj y la devuelve al pool.
+ *
+ * @param self Instancia del reloj (puede ser NULL).
+ */
+
+void ClockDestroy(clock_t self) {
+    if (self != NULL) {
+        self->in_use = false;
+    }
+}
+
+/**
+ * @brief Notifica un tick de la base de tiempo común a todos los relojes activos.
+ *
+ * @return true si en este tick se disparó la alarma de alguno de los relojes.
+ */
+
+bool ClockNewTickAll(void) {
+    bool fired = false;
+    for (uint8_t index = 0; index < CLOCK_MAX_INSTANCES; index++) {
+        if (instances[index].in_use) {
+            fired |= ClockNewTick(&instances[index]);
+        }
+    }
+    return fired;
+}
+
+/**
+ * @brief Avanza todos los relojes activos una cantidad arbitraria de ticks de la base de tiempo común.
+ *
+ * @param ticks Cantidad de ticks transcurridos.
+ * @return true si en el intervalo coincidió la alarma de alguno de los relojes.
+ */
+
+bool ClockAdvanceTicksAll(uint32_t ticks) {
+    bool matched = false;
+    for (uint8_t index = 0; index < CLOCK_MAX_INSTANCES; index++) {
+        if (instances[index].in_use) {
+            matched |= ClockAdvanceTicks(&instances[index], ticks);
+        }
+    }
+    return matched;
+}
+
 
 /**
  * @brief Obtiene la hora actual del reloj.
  *
+ * Lee la instantánea publicada por el escritor sin tomar ningún mutex, por lo que puede llamarse desde cualquier
+ * tarea o interrupción. Si el escritor publica mientras se lee, se repite la lectura; el resultado nunca mezcla
+ * dígitos de dos segundos distintos.
+ *
  * @param self Instancia del reloj.
  * @param result Puntero donde se almacena la hora en formato BCD.
  * @return true si la hora es válida, false si aún no ha sido configurada.
  */
 
 bool ClockGetTime(clock_t self, clock_time_t * result) {
-    memcpy(result, &self->current_time, sizeof(clock_time_t));
-    return self->is_valid; 
+    uint32_t sequence;
+    clock_snapshot_t value;
+
+    do {
+        sequence = self->sequence;
+        CLOCK_MEMORY_BARRIER();
+        value = self->snapshot[sequence & 1u];
+        CLOCK_MEMORY_BARRIER();
+    } while (sequence != self->sequence);
+
+    ClockTimeUnpack(value.time, result);
+    return value.is_valid;
 }
 
 /**
@@ -104,8 +568,11 @@ bool ClockGetTime(clock_t self, clock_time_t * result) {
 
 bool ClockSetTime(clock_t self, const clock_time_t * new_time) {
     self->is_valid = true; // Marca la hora como válida
-    memcpy(&self->current_time, new_time, sizeof(clock_time_t));
+    self->seconds = BcdToSeconds(new_time);
+    self->packed_time = ClockTimePack(new_time);
+    TimePublish(self);
     self->tick_counter = 0; // Reinicia el contador de ticks al establecer nueva hora
+    AlarmCountdownUpdate(self);
     return self->is_valid;
 }
 
@@ -113,62 +580,123 @@ bool ClockSetTime(clock_t self, const clock_time_t * new_time) {
  * @brief Notifica al reloj que ha transcurrido un tick.
  *
  * Cuando se alcanza la cantidad de ticks correspondiente a un segundo, la hora se incrementa.
- * Esta función debe ser llamada periódicamente por el sistema.
+ * Esta función debe ser llamada periódicamente por el sistema. En la mayoría de los ticks solo se
+ * incrementa y compara el contador; el paso de segundo es un incremento del contador binario y el
+ * formato BCD se reconstruye recién cuando alguien consulta la hora. Solo se revisa la cabeza del
+ * índice de alarmas, por lo que el costo no depende de cuántas alarmas haya configuradas.
  *
  * @param self Instancia del reloj.
+ * @return true solo en el tick en que la hora entra en el minuto de alguna alarma habilitada.
  */
 
-void ClockNewTick(clock_t self) {
+bool ClockNewTick(clock_t self) {
     self->tick_counter++; 
-    bool end_of_day = false; 
-
-    if (self->is_valid && !self->init_mode) {
-        end_of_day = (self->current_time.time.hours[1] == 2 &&
-                      self->current_time.time.hours[0] == 3 &&
-                      self->current_time.time.minutes[1] == 5 &&
-                      self->current_time.time.minutes[0] == 9 &&
-                      self->current_time.time.seconds[1] == 5 &&
-                      self->current_time.time.seconds[0] == 9);
+    if (self->tick_counter < self->clock_ticks) {
+        return false;
     }
-    
+
     // Solo incrementar el tiempo si la hora es válida
-    if (self->is_valid && !self->init_mode && self->tick_counter >= self->clock_ticks) {
-        self->tick_counter = 0;  
-
-        // Aumentar 1 segundo en formato BCD
-        self->current_time.time.seconds[0]++;
-        if (self->current_time.time.seconds[0] == 10) {
-            self->current_time.time.seconds[0] = 0;
-            self->current_time.time.seconds[1]++;
-        }
-        if (self->current_time.time.seconds[1] == 6) {
-            self->current_time.time.seconds[1] = 0;
-            self->current_time.time.minutes[0]++;
-        }
-        if (self->current_time.time.minutes[0] == 10) {
-            self->current_time.time.minutes[0] = 0;
-            self->current_time.time.minutes[1]++;
-        }
-        if (self->current_time.time.minutes[1] == 6) {
-            self->current_time.time.minutes[1] = 0;
-            self->current_time.time.hours[0]++;
+    if (!self->is_valid || self->init_mode) {
+        return false;
+    }
+
+    self->tick_counter = 0;
+    self->seconds++;
+    self->packed_time = ClockPackedIncrement(self->packed_time);
+    TimePublish(self);
+
+    if (self->seconds >= SECONDS_PER_DAY) {
+        // Medianoche: las alarmas canceladas por hoy vuelven a quedar armadas
+        self->seconds = 0;
+        if (self->any_skipped) {
+            for (uint8_t id = 0; id < CLOCK_MAX_ALARMS; id++) {
+                if (self->alarms[id].skipped_today) {
+                    self->alarms[id].active = true;
+                    self->alarms[id].skipped_today = false;
+                }
+            }
+            self->any_skipped = false;
         }
-        if (self->current_time.time.hours[0] == 10) {
-            self->current_time.time.hours[0] = 0;
-            self->current_time.time.hours[1]++;
+    }
+
+    bool fired = false;
+    self->seconds_to_alarm--;
+    if (self->seconds_to_alarm == 0) {
+        fired = AlarmFireNext(self);
+    }
+    if (self->observer_count != 0) {
+        EdgesNotify(self, EdgesAt(self->seconds));
+    }
+    return fired;
+}
+
+/**
+ * @brief Avanza el reloj una cantidad arbitraria de ticks en tiempo constante.
+ *
+ * Equivale a llamar ticks veces a ClockNewTick: respeta el paso por la medianoche y el rearmado de las alarmas
+ * canceladas por hoy. Si en algún momento del intervalo una alarma coincide con la hora, se informa en el valor
+ * de retorno para que la coincidencia no se pierda.
+ *
+ * @param self Instancia del reloj.
+ * @param ticks Cantidad de ticks transcurridos.
+ * @return true si alguna alarma habilitada coincidió con la hora en algún momento del intervalo.
+ */
+
+bool ClockAdvanceTicks(clock_t self, uint32_t ticks) {
+    if (!self->is_valid || self->init_mode) {
+        // Sin hora no avanza nada, pero el contador conserva la fracción de segundo igual que con hora válida
+        self->tick_counter = (self->tick_counter + ticks % self->clock_ticks) % self->clock_ticks;
+        return false;
+    }
+
+    uint32_t elapsed = ticks / self->clock_ticks;
+    uint32_t remainder = self->tick_counter + ticks % self->clock_ticks;
+    if (remainder >= self->clock_ticks) {
+        remainder -= self->clock_ticks;
+        elapsed++;
+    }
+    self->tick_counter = remainder;
+
+    uint32_t start = self->seconds;
+    uint64_t end = (uint64_t)start + elapsed;
+    bool crosses_midnight = (end >= SECONDS_PER_DAY);
+    bool matched = false;
+
+    for (uint8_t id = 0; id < CLOCK_MAX_ALARMS; id++) {
+        clock_alarm_t * alarm = &self->alarms[id];
+        bool was_active = alarm->active;
+
+        if (was_active) {
+            matched |= IntervalHitsAlarm(alarm, (uint64_t)start + 1, end);
         }
-        if (self->current_time.time.hours[1] == 2 && self->current_time.time.hours[0] == 4) {
-            self->current_time.time.hours[0] = 0;
-            self->current_time.time.hours[1] = 0;
+        if (crosses_midnight && alarm->skipped_today) {
+            // El intervalo cruza la medianoche: la alarma vuelve a estar armada desde las 00:00:00
+            alarm->active = true;
+            alarm->skipped_today = false;
+            if (!was_active) {
+                matched |= IntervalHitsAlarm(alarm, 0, end - SECONDS_PER_DAY);
+            }
         }
     }
+    if (crosses_midnight) {
+        self->any_skipped = false;
+    }
 
-    if (end_of_day) {
-        if (self->skippedToday) {
-            self->alarm_active = true;
-            self->skippedToday = false;
+    if (elapsed != 0) {
+        self->seconds = end % SECONDS_PER_DAY;
+        TimeRepublish(self);
+        AlarmCountdownUpdate(self);
+
+        if (self->observer_count != 0) {
+            // Se informa una sola vez la unión de todos los flancos cruzados en el intervalo
+            uint8_t edges = CLOCK_EDGE_SECOND;
+            edges |= (start / SECONDS_PER_MINUTE != end / SECONDS_PER_MINUTE) ? CLOCK_EDGE_MINUTE : 0;
+            edges |= (start / SECONDS_PER_HOUR != end / SECONDS_PER_HOUR) ? CLOCK_EDGE_HOUR : 0;
+            edges |= crosses_midnight ? CLOCK_EDGE_DAY : 0;
+            EdgesNotify(self, edges);
         }
     }
+    return matched;
 }
 
 /**
@@ -180,8 +708,32 @@ void ClockNewTick(clock_t self) {
  * @param self Instancia del reloj.
  */
 void ClockCancelAlarmToday(clock_t self) {
-    self->alarm_active = false;
-    self->skippedToday = true;
+    ClockCancelAlarmTodayById(self, CLOCK_DEFAULT_ALARM);
+}
+
+/**
+ * @brief Cancela una alarma de la tabla solo para el día actual.
+ *
+ * Descarta lo pospuesto: mañana la alarma vuelve a sonar a la hora programada.
+ *
+ * @param self Instancia del reloj.
+ * @param id Identificador de la alarma.
+ */
+
+void ClockCancelAlarmTodayById(clock_t self, uint8_t id) {
+    clock_alarm_t * alarm = AlarmGet(self, id);
+    if (alarm == NULL) {
+        return;
+    }
+
+    alarm->active = false;
+    alarm->skipped_today = true;
+    self->any_skipped = true;
+    if (alarm->snooze != 0) {
+        alarm->snooze = 0;
+        alarm->view_cached = false;
+        AlarmScheduleUpdate(self);
+    }
 }
 
 
@@ -194,7 +746,29 @@ void ClockCancelAlarmToday(clock_t self) {
  */
 
 bool ClockSetAlarm(clock_t self, const clock_time_t * alarm_time) {
-    memcpy(&self->alarm_time, alarm_time, sizeof(clock_time_t));
+    return ClockSetAlarmById(self, CLOCK_DEFAULT_ALARM, alarm_time);
+}
+
+/**
+ * @brief Establece la hora de una alarma de la tabla.
+ *
+ * @param self Instancia del reloj.
+ * @param id Identificador de la alarma.
+ * @param alarm_time Hora de la alarma en formato BCD.
+ * @return true si se estableció correctamente, false si el identificador no existe.
+ */
+
+bool ClockSetAlarmById(clock_t self, uint8_t id, const clock_time_t * alarm_time) {
+    clock_alarm_t * alarm = AlarmGet(self, id);
+    if (alarm == NULL) {
+        return false;
+    }
+
+    alarm->seconds = BcdToSeconds(alarm_time);
+    alarm->snooze = 0;
+    memcpy(&alarm->view, alarm_time, sizeof(clock_time_t));
+    alarm->view_cached = true;
+    AlarmScheduleUpdate(self);
     return true;
 }
 
@@ -207,7 +781,29 @@ bool ClockSetAlarm(clock_t self, const clock_time_t * alarm_time) {
  */
 
 bool ClockGetAlarm(clock_t self, clock_time_t * alarm_time) {
-    memcpy(alarm_time, &self->alarm_time, sizeof(clock_time_t));
+    return ClockGetAlarmById(self, CLOCK_DEFAULT_ALARM, alarm_time);
+}
+
+/**
+ * @brief Obtiene la hora efectiva de una alarma de la tabla, incluido lo pospuesto.
+ *
+ * @param self Instancia del reloj.
+ * @param id Identificador de la alarma.
+ * @param alarm_time Puntero donde se almacenará la hora de la alarma.
+ * @return true si se recuperó correctamente, false si el identificador no existe.
+ */
+
+bool ClockGetAlarmById(clock_t self, uint8_t id, clock_time_t * alarm_time) {
+    clock_alarm_t * alarm = AlarmGet(self, id);
+    if (alarm == NULL) {
+        return false;
+    }
+
+    if (!alarm->view_cached) {
+        SecondsToBcd((alarm->seconds + alarm->snooze) % SECONDS_PER_DAY, &alarm->view);
+        alarm->view_cached = true;
+    }
+    memcpy(alarm_time, &alarm->view, sizeof(clock_time_t));
     return true;
 }
 
@@ -219,16 +815,26 @@ bool ClockGetAlarm(clock_t self, clock_time_t * alarm_time) {
  */
 
 bool ClockAlarmMatchTheTime(clock_t self) {
-    if (!self->alarm_active || !self->is_valid) {
+    return ClockAlarmMatchTheTimeById(self, CLOCK_DEFAULT_ALARM);
+} 
+
+/**
+ * @brief Verifica si la hora actual coincide con una alarma de la tabla.
+ *
+ * @param self Instancia del reloj.
+ * @param id Identificador de la alarma.
+ * @return true si la hora actual coincide con la alarma y esta está habilitada.
+ */
+
+bool ClockAlarmMatchTheTimeById(clock_t self, uint8_t id) {
+    clock_alarm_t * alarm = AlarmGet(self, id);
+    if (alarm == NULL || !alarm->active || !self->is_valid) {
         return false;
     }
-    
+
     // Comparar horas y minutos (ignorar segundos)
-    return (self->current_time.time.hours[0] == self->alarm_time.time.hours[0] &&
-            self->current_time.time.hours[1] == self->alarm_time.time.hours[1] &&
-            self->current_time.time.minutes[0] == self->alarm_time.time.minutes[0] &&
-            self->current_time.time.minutes[1] == self->alarm_time.time.minutes[1]);
-} 
+    return (self->seconds - self->seconds % SECONDS_PER_MINUTE) == AlarmFireSecond(alarm);
+}
 
 /**
  * @brief Habilita la alarma del reloj.
@@ -237,7 +843,23 @@ bool ClockAlarmMatchTheTime(clock_t self) {
  */
 
 void ClockEnableAlarm(clock_t self) {
-    self->alarm_active = true;
+    ClockEnableAlarmById(self, CLOCK_DEFAULT_ALARM);
+}
+
+/**
+ * @brief Habilita una alarma de la tabla.
+ *
+ * El índice de disparo incluye también a las alarmas deshabilitadas, así que no hace falta reordenarlo.
+ *
+ * @param self Instancia del reloj.
+ * @param id Identificador de la alarma.
+ */
+
+void ClockEnableAlarmById(clock_t self, uint8_t id) {
+    clock_alarm_t * alarm = AlarmGet(self, id);
+    if (alarm != NULL) {
+        alarm->active = true;
+    }
 }
 
 /**
@@ -247,7 +869,28 @@ void ClockEnableAlarm(clock_t self) {
  */
 
 void ClockDisableAlarm(clock_t self) {
-    self->alarm_active = false;
+    ClockDisableAlarmById(self, CLOCK_DEFAULT_ALARM);
+}
+
+/**
+ * @brief Deshabilita una alarma de la tabla y descarta lo pospuesto.
+ *
+ * @param self Instancia del reloj.
+ * @param id Identificador de la alarma.
+ */
+
+void ClockDisableAlarmById(clock_t self, uint8_t id) {
+    clock_alarm_t * alarm = AlarmGet(self, id);
+    if (alarm == NULL) {
+        return;
+    }
+
+    alarm->active = false;
+    if (alarm->snooze != 0) {
+        alarm->snooze = 0;
+        alarm->view_cached = false;
+        AlarmScheduleUpdate(self);
+    }
 }
 
 /**
@@ -258,7 +901,50 @@ void ClockDisableAlarm(clock_t self) {
  */
 
 bool ClockIsAlarmEnabled(clock_t self) {
-    return self->alarm_active;
+    return ClockIsAlarmEnabledById(self, CLOCK_DEFAULT_ALARM);
+}
+
+/**
+ * @brief Consulta si una alarma de la tabla está habilitada.
+ *
+ * @param self Instancia del reloj.
+ * @param id Identificador de la alarma.
+ * @return true si la alarma está habilitada, false en caso contrario o si el identificador no existe.
+ */
+
+bool ClockIsAlarmEnabledById(clock_t self, uint8_t id) {
+    clock_alarm_t * alarm = AlarmGet(self, id);
+    return alarm != NULL && alarm->active;
+}
+
+/**
+ * @brief Consulta cuánto falta para que suene la próxima alarma habilitada.
+ *
+ * Recorre el índice de disparo desde la cabeza hasta encontrar una alarma habilitada.
+ *
+ * @param self Instancia del reloj.
+ * @param seconds Puntero donde se almacenan los segundos que faltan para el minuto de la alarma.
+ * @return true si hay alguna alarma habilitada y la hora es válida, false en caso contrario.
+ */
+
+bool ClockTimeUntilAlarm(clock_t self, uint32_t * seconds) {
+    uint32_t now = self->seconds % SECONDS_PER_DAY;
+    uint8_t position = self->next_alarm;
+
+    for (uint8_t count = 0; count < CLOCK_MAX_ALARMS; count++) {
+        const clock_alarm_t * alarm = &self->alarms[self->alarm_order[position]];
+        if (alarm->active) {
+            *seconds = (AlarmFireSecond(alarm) + SECONDS_PER_DAY - now) % SECONDS_PER_DAY;
+            if (*seconds == 0) {
+                *seconds = SECONDS_PER_DAY;
+            }
+            return self->is_valid;
+        }
+        if (++position == CLOCK_MAX_ALARMS) {
+            position = 0;
+        }
+    }
+    return false;
 }
 
 /**
@@ -272,23 +958,66 @@ bool ClockIsAlarmEnabled(clock_t self) {
  */
 
 void ClockPostponeAlarm(clock_t self, uint8_t minutes) {
-    if (!self->alarm_active || minutes == 0) return;
+    ClockPostponeAlarmById(self, CLOCK_DEFAULT_ALARM, minutes);
+}
+
+/**
+ * @brief Pospone una alarma de la tabla una cantidad arbitraria de minutos.
+ *
+ * Lo pospuesto se acumula aparte de la hora programada, que se recupera al cancelar o deshabilitar la alarma.
+ *
+ * @param self Instancia del reloj.
+ * @param id Identificador de la alarma.
+ * @param minutes Minutos a sumar a la hora de la alarma.
+ */
+
+void ClockPostponeAlarmById(clock_t self, uint8_t id, uint8_t minutes) {
+    clock_alarm_t * alarm = AlarmGet(self, id);
+    if (alarm == NULL || !alarm->active || minutes == 0) return;
+
+    alarm->snooze = (alarm->snooze + minutes * SECONDS_PER_MINUTE) % SECONDS_PER_DAY;
+    alarm->view_cached = false;
+    AlarmScheduleUpdate(self);
+}
+
+/**
+ * @brief Registra un observador de los cambios de la hora.
+ *
+ * @param self Instancia del reloj.
+ * @param edges Máscara de clock_edge_t con los flancos de interés.
+ * @param observer Función a llamar.
+ * @param context Puntero que se entrega a la función en cada llamada.
+ * @return true si se registró, false si la tabla de observadores está llena.
+ */
+
+bool ClockAddObserver(clock_t self, uint8_t edges, clock_observer_t observer, void * context) {
+    if (observer == NULL || self->observer_count >= CLOCK_MAX_OBSERVERS) {
+        return false;
+    }
 
-    // Convertir BCD a binario
-    uint8_t mins = self->alarm_time.time.minutes[0] + self->alarm_time.time.minutes[1] * 10;
-    uint8_t hrs = self->alarm_time.time.hours[0] + self->alarm_time.time.hours[1] * 10;
+    clock_observer_entry_t * entry = &self->observers[self->observer_count++];
+    entry->callback = observer;
+    entry->context = context;
+    entry->edges = edges;
+    return true;
+}
 
-    // Sumar minutos
-    mins += minutes;
-    hrs += mins / 60;
-    mins %= 60;
-    hrs %= 24;
+/**
+ * @brief Quita un observador de los cambios de la hora.
+ *
+ * @param self Instancia del reloj.
+ * @param observer Función registrada.
+ * @param context Puntero registrado junto con la función.
+ */
 
-    // Convertir de vuelta a BCD
-    self->alarm_time.time.minutes[0] = mins % 10;
-    self->alarm_time.time.minutes[1] = mins / 10;
-    self->alarm_time.time.hours[0] = hrs % 10;
-    self->alarm_time.time.hours[1] = hrs / 10;
+void ClockRemoveObserver(clock_t self, clock_observer_t observer, void * context) {
+    for (uint8_t index = 0; index < self->observer_count; index++) {
+        if (self->observers[index].callback == observer && self->observers[index].context == context) {
+            // Se mueve el último a este lugar para mantener los registrados al principio del arreglo
+            self->observers[index] = self->observers[--self->observer_count];
+            return;
+        }
+    }
 }
 
 /**
@@ -302,8 +1031,10 @@ void ClockPostponeAlarm(clock_t self, uint8_t minutes) {
 _Bool ClockCancelSetTime(clock_t self) {
     if (!self->is_valid) {
         // Primer encendido: poner la hora en 00:00
-        memset(&self->current_time, 0, sizeof(clock_time_t));
+        self->seconds = 0;
+        TimeRepublish(self);
         self->tick_counter = 0;
+        AlarmCountdownUpdate(self);
         self->init_mode = true;   // Activar modo init
         // is_valid sigue en false, para que el reloj sepa que aún no se configuró
     } else {
@@ -17,13 +17,15 @@ OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
 SPDX-License-Identifier: MIT
 *********************************************************************************************************************/
 
-/** @file screen.c
- ** @brief implemntacion del modulo para la gestion de una pantalla multplexada de 7 segmentos
+/** @file clock_task.c
+ ** @brief Avance del reloj desde la interrupción de la base de tiempo de la placa, con el aviso de la alarma y la
+ ** medición del costo de cada tick.
  **/
 
 /* === Headers files inclusions ==================================================================================== */
 
 #include "clock_task.h"
+#include "chip.h"
 
 /* === Macros definitions ========================================================================================== */
 
@@ -35,26 +37,44 @@ SPDX-License-Identifier: MIT
 
 /* === Public variable definitions ================================================================================= */
 
+clock_timebase_stats_t clock_timebase_stats;
+
 /* === Private function definitions ================================================================================ */
 
 /* === Public function implementation ============================================================================== */
 
-void vClockTask(void *pvParameters) {
-    for (;;) {
-        ClockNewTick(clock);  // el RTC simulado sigue corriendo
-
-        if (xSemaphoreTake(xStateMutex, portMAX_DELAY)) {
-            // SOLO actualizar time_clock desde el reloj en estados que no son de edición
-            if (state == STATE_NORMAL || state == STATE_CLOCK_INIT) {
-                ClockGetTime(clock, &time_clock);
-            }
-            xSemaphoreGive(xStateMutex);
-        }
+void ClockNewTickFromISR(uint32_t ticks, void * context) {
+    BaseType_t higher_priority_woken = pdFALSE;
+    uint32_t start = DWT->CYCCNT;
 
-        HandleAlarm();  // función de la alarma (después la moveremos a su archivo)
+    (void)context;
+    // Después de una suspensión llegan varios ticks juntos: se avanza en tiempo constante sin perder la alarma
+    bool alarm_fired = (ticks == 1) ? ClockNewTickAll() : ClockAdvanceTicksAll(ticks);
+    if (alarm_fired) {
+        // Tick a tick solo al llegar a la alarma; al recuperar ticks, cada vez que el intervalo toca su minuto
+        HandleAlarmFromISR(&higher_priority_woken);
+    }
 
-        vTaskDelay(pdMS_TO_TICKS(1));
+    uint32_t cycles = DWT->CYCCNT - start;
+    clock_timebase_stats.interrupts++;
+    clock_timebase_stats.ticks += ticks;
+    clock_timebase_stats.cycles += cycles;
+    if (cycles > clock_timebase_stats.max_cycles) {
+        clock_timebase_stats.max_cycles = cycles;
+    }
+    if (higher_priority_woken) {
+        clock_timebase_stats.wakeups++;
     }
+    portYIELD_FROM_ISR(higher_priority_woken);
+}
+
+bool ClockTaskStart(timebase_driver_t timebase) {
+    // Contador de ciclos del núcleo, para las estadísticas de la base de tiempo
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CYCCNT = 0;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+    return timebase->Start(CLOCK_TICKS_PER_SECOND, ClockNewTickFromISR, NULL);
 }
 
 uint32_t ClockGetTicks(void) {
@@ -0,0 +1,69 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Roldan JesusAlejandro <kechuroldanjesus@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+/** @file debounce.c
+ ** @brief Implementación del antirrebote con contadores verticales.
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "debounce.h"
+
+/* === Macros definitions ========================================================================================== */
+
+/* === Private data type declarations ============================================================================== */
+
+/* === Private function declarations =============================================================================== */
+
+/* === Private variable definitions ================================================================================ */
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private function definitions ================================================================================ */
+
+/* === Public function implementation ============================================================================== */
+
+void DebounceInit(debounce_t * self, uint32_t state) {
+    self->state = state;
+    self->count_0 = UINT32_MAX;
+    self->count_1 = UINT32_MAX;
+}
+
+debounce_edges_t DebounceUpdate(debounce_t * self, uint32_t sample) {
+    debounce_edges_t result;
+    uint32_t changed = self->state ^ sample;
+
+    // Las teclas sin cambio vuelven a 3; las que cambiaron cuentan hacia abajo 3, 2, 1, 0 y al pasar de 0 a 3
+    // se acepta el nuevo estado
+    self->count_0 = ~(self->count_0 & changed);
+    self->count_1 = self->count_0 ^ (self->count_1 & changed);
+    changed &= self->count_0 & self->count_1;
+    self->state ^= changed;
+
+    result.state = self->state;
+    result.pressed = changed & self->state;
+    result.released = changed & ~self->state;
+    return result;
+}
+
+uint32_t DebouncePending(const debounce_t * self, uint32_t sample) {
+    return self->state ^ sample;
+}
+
+/* === End of documentation ======================================================================================== */
@@ -31,6 +31,11 @@ SPDX-License-Identifier: MIT
 
 /* === Macros definitions ========================================================================================== */
 
+// Prioridad de las interrupciones de las entradas; no puede superar configLIBRARY_MAX_SYSCALL_INTERRUPT_PRIORITY
+#ifndef DIGITAL_INTERRUPT_PRIORITY
+#define DIGITAL_INTERRUPT_PRIORITY 6
+#endif
+
 /* === Private data type declarations ============================================================================== */
 
 /**
@@ -58,14 +63,61 @@ typedef struct DigitalInputS {
 
 } DigitalInputS;
 
+/**
+ * @brief Entrada asociada a cada canal de interrupción por pin
+ */
+
+typedef struct {
+    DigitalInputT input;             /**< Entrada que genera la interrupción */
+    digital_input_handler_t handler; /**< Función a llamar en cada flanco */
+    void * context;                  /**< Puntero que se entrega a la función */
+} digital_interrupt_t;
+
+/**
+ * @brief Estructura para representar un grupo de entradas leídas juntas
+ */
+
+typedef struct DigitalInputGroupS {
+
+    uint8_t ports[DIGITAL_GROUP_MAX_PORTS];       /**< Puertos GPIO que usa el grupo, sin repetir */
+    uint8_t port_count;                           /**< Cantidad de puertos que usa el grupo */
+    uint8_t input_port[DIGITAL_GROUP_MAX_INPUTS]; /**< Índice en ports del puerto de cada entrada */
+    uint8_t input_pin[DIGITAL_GROUP_MAX_INPUTS];  /**< Pin de cada entrada dentro de su puerto */
+    uint8_t count;                                /**< Cantidad de entradas del grupo */
+    uint32_t inverted;                            /**< Entradas con lógica invertida */
+
+} DigitalInputGroupS;
+
 /* === Private function declarations =============================================================================== */
 
+/**
+ * @brief Atiende la interrupción de un canal PININT: limpia los flancos y llama a la función registrada.
+ *
+ * @param channel Canal que interrumpió.
+ */
+
+static void DigitalInterruptDispatch(uint8_t channel);
+
 /* === Private variable definitions ================================================================================ */
 
+static digital_interrupt_t interrupts[DIGITAL_INTERRUPT_CHANNELS];
+
 /* === Public variable definitions ================================================================================= */
 
 /* === Private function definitions ================================================================================ */
 
+static void DigitalInterruptDispatch(uint8_t channel) {
+    digital_interrupt_t * entry = &interrupts[channel];
+
+    Chip_PININT_ClearRiseStates(LPC_GPIO_PIN_INT, PININTCH(channel));
+    Chip_PININT_ClearFallStates(LPC_GPIO_PIN_INT, PININTCH(channel));
+    Chip_PININT_ClearIntStatus(LPC_GPIO_PIN_INT, PININTCH(channel));
+
+    if (entry->handler != NULL) {
+        entry->handler(entry->input, DigitalInputGetState(entry->input), entry->context);
+    }
+}
+
 /* === Public function implementation ============================================================================== */
 
 DigitalOutputT DigitalOutputCreate (int gpio, int bit, bool state) {
@@ -80,6 +132,17 @@ DigitalOutputT DigitalOutputCreate (int gpio, int bit, bool state) {
     }
     return self;
 }
+
+/**
+ * @brief Libera un objeto de salida digital.
+ * 
+ * @param self Objeto de salida digital (puede ser NULL).
+ */
+
+void DigitalOutputDestroy(DigitalOutputT self) {
+    free(self);
+}
+
 /**
  * @brief Activa (pone en alto) la salida digital.
  * 
@@ -136,6 +199,16 @@ DigitalInputT DigitalInputCreate(int port, int pin, bool inverted) {
     return self;
 }
 
+/**
+ * @brief Libera un objeto de entrada digital.
+ * 
+ * @param self Objeto de entrada digital (puede ser NULL).
+ */
+
+void DigitalInputDestroy(DigitalInputT self) {
+    free(self);
+}
+
 /**
  * @brief Lee el estado actual de la entrada digital.
  * 
@@ -196,4 +269,150 @@ bool DigitalInputHasDeactivate(DigitalInputT self) {
     return DigitalInputHasChanged(self) == -1;
 }
 
+/**
+ * @brief Habilita la interrupción por ambos flancos de la entrada en un canal PININT.
+ * 
+ * @param self Objeto de entrada digital.
+ * @param channel Canal de interrupción.
+ * @param handler Función a llamar en cada flanco.
+ * @param context Puntero que se entrega a la función.
+ * @return true si se habilitó.
+ */
+
+bool DigitalInputEnableInterrupt(DigitalInputT self, uint8_t channel, digital_input_handler_t handler,
+                                 void * context) {
+    if (channel >= DIGITAL_INTERRUPT_CHANNELS || handler == NULL) {
+        return false;
+    }
+
+    interrupts[channel].input = self;
+    interrupts[channel].handler = handler;
+    interrupts[channel].context = context;
+
+    Chip_PININT_Init(LPC_GPIO_PIN_INT);
+    Chip_SCU_GPIOIntPinSel(channel, self->port, self->pin);
+    Chip_PININT_SetPinModeEdge(LPC_GPIO_PIN_INT, PININTCH(channel));
+    Chip_PININT_EnableIntHigh(LPC_GPIO_PIN_INT, PININTCH(channel));
+    Chip_PININT_EnableIntLow(LPC_GPIO_PIN_INT, PININTCH(channel));
+    Chip_PININT_ClearIntStatus(LPC_GPIO_PIN_INT, PININTCH(channel));
+
+    // La función registrada usa funciones FromISR de FreeRTOS
+    IRQn_Type irq = (IRQn_Type)(PIN_INT0_IRQn + channel);
+    NVIC_SetPriority(irq, DIGITAL_INTERRUPT_PRIORITY);
+    NVIC_ClearPendingIRQ(irq);
+    NVIC_EnableIRQ(irq);
+    return true;
+}
+
+/**
+ * @brief Crea un grupo de entradas vacío.
+ * 
+ * @return DigitalInputGroupT Puntero al grupo creado, o NULL si falla la reserva de memoria.
+ */
+
+DigitalInputGroupT DigitalInputGroupCreate(void) {
+    DigitalInputGroupT self = malloc(sizeof(struct DigitalInputGroupS));
+    if (self != NULL) {
+        self->port_count = 0;
+        self->count = 0;
+        self->inverted = 0;
+    }
+    return self;
+}
+
+/**
+ * @brief Libera un grupo de entradas; las entradas siguen siendo de quien las creó.
+ * 
+ * @param self Grupo de entradas (puede ser NULL).
+ */
+
+void DigitalInputGroupDestroy(DigitalInputGroupT self) {
+    free(self);
+}
+
+/**
+ * @brief Agrega una entrada al grupo.
+ * 
+ * @param self Grupo de entradas.
+ * @param input Entrada a agregar.
+ * @return true si se agregó.
+ */
+
+bool DigitalInputGroupAdd(DigitalInputGroupT self, DigitalInputT input) {
+    uint8_t port = 0;
+
+    if (self->count >= DIGITAL_GROUP_MAX_INPUTS) {
+        return false;
+    }
+
+    while (port < self->port_count && self->ports[port] != input->port) {
+        port++;
+    }
+    if (port == self->port_count) {
+        self->ports[self->port_count++] = input->port;
+    }
+
+    uint32_t bit = 1u << self->count;
+    self->input_port[self->count] = port;
+    self->input_pin[self->count] = input->pin;
+    if (input->inverted) {
+        self->inverted |= bit;
+    }
+    self->count++;
+    return true;
+}
+
+/**
+ * @brief Lee todas las entradas del grupo.
+ * 
+ * @param self Grupo de entradas.
+ * @return Estado actual, un bit por entrada.
+ */
+
+uint32_t DigitalInputGroupScan(DigitalInputGroupT self) {
+    uint32_t values[DIGITAL_GROUP_MAX_PORTS];
+    uint32_t state = 0;
+
+    // Un solo acceso al bus por puerto, sin importar cuántas entradas tenga
+    for (uint8_t port = 0; port < self->port_count; port++) {
+        values[port] = Chip_GPIO_GetPortValue(LPC_GPIO_PORT, self->ports[port]);
+    }
+    for (uint8_t input = 0; input < self->count; input++) {
+        state |= ((values[self->input_port[input]] >> self->input_pin[input]) & 1u) << input;
+    }
+    return state ^ self->inverted;
+}
+
+void GPIO0_IRQHandler(void) {
+    DigitalInterruptDispatch(0);
+}
+
+void GPIO1_IRQHandler(void) {
+    DigitalInterruptDispatch(1);
+}
+
+void GPIO2_IRQHandler(void) {
+    DigitalInterruptDispatch(2);
+}
+
+void GPIO3_IRQHandler(void) {
+    DigitalInterruptDispatch(3);
+}
+
+void GPIO4_IRQHandler(void) {
+    DigitalInterruptDispatch(4);
+}
+
+void GPIO5_IRQHandler(void) {
+    DigitalInterruptDispatch(5);
+}
+
+void GPIO6_IRQHandler(void) {
+    DigitalInterruptDispatch(6);
+}
+
+void GPIO7_IRQHandler(void) {
+    DigitalInterruptDispatch(7);
+}
+
 /* === End of documentation ======================================================================================== */
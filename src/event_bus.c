@@ -0,0 +1,100 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Roldan JesusAlejandro <kechuroldanjesus@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+/** @file event_bus.c
+ ** @brief Implementación del bus de eventos con notificaciones de tarea.
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "event_bus.h"
+#include "queue.h"
+
+/* === Macros definitions ========================================================================================== */
+
+/* === Private data type declarations ============================================================================== */
+
+/* === Private function declarations =============================================================================== */
+
+/* === Private variable definitions ================================================================================ */
+
+static TaskHandle_t bus_consumer = NULL;
+static QueueHandle_t bus_keys = NULL;
+
+/* === Public variable definitions ================================================================================= */
+
+event_bus_stats_t event_bus_stats;
+
+/* === Private function definitions ================================================================================ */
+
+/* === Public function implementation ============================================================================== */
+
+bool EventBusInit(TaskHandle_t consumer) {
+    bus_keys = xQueueCreate(EVENT_BUS_KEY_QUEUE_LENGTH, sizeof(app_event_t));
+    bus_consumer = consumer;
+    return bus_keys != NULL;
+}
+
+void EventBusPost(uint32_t events) {
+    event_bus_stats.posts++;
+    if (bus_consumer != NULL) {
+        xTaskNotify(bus_consumer, events, eSetBits);
+    }
+}
+
+void EventBusPostFromISR(uint32_t events, BaseType_t * higher_priority_woken) {
+    // La base de tiempo puede interrumpir antes de que exista el consumidor
+    event_bus_stats.posts++;
+    if (bus_consumer != NULL) {
+        xTaskNotifyFromISR(bus_consumer, events, eSetBits, higher_priority_woken);
+    }
+}
+
+bool EventBusSendKey(const app_event_t * event, TickType_t wait) {
+    if (xQueueSend(bus_keys, event, wait) != pdPASS) {
+        event_bus_stats.key_overruns++;
+        return false;
+    }
+    EventBusPost(EVENT_BUS_KEY);
+    return true;
+}
+
+bool EventBusReceiveKey(app_event_t * event) {
+    return xQueueReceive(bus_keys, event, 0) == pdPASS;
+}
+
+uint32_t EventBusWait(TickType_t timeout) {
+    uint32_t events = 0;
+
+    if (xTaskNotifyWait(0, UINT32_MAX, &events, timeout) != pdTRUE) {
+        return EVENT_BUS_TIMEOUT;
+    }
+    event_bus_stats.wakeups++;
+    return events;
+}
+
+uint32_t EventBusNext(uint32_t * pending) {
+    // El bit más bajo es el de mayor prioridad
+    uint32_t event = *pending & (~*pending + 1);
+
+    *pending &= ~event;
+    return event;
+}
+
+/* === End of documentation ======================================================================================== */
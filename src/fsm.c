@@ -0,0 +1,310 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Roldan JesusAlejandro <kechuroldanjesus@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+/** @file fsm.c
+ ** @brief Implementación de la máquina de estados de la interfaz del reloj con tablas constantes.
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "fsm.h"
+#include <stddef.h>
+
+/* === Macros definitions ========================================================================================== */
+
+/** @brief Minutos que se posterga la alarma al aceptarla mientras suena */
+#define FSM_SNOOZE_MINUTES 5
+
+/* === Private data type declarations ============================================================================== */
+
+/**
+ * @brief Acción de una transición: aplica los efectos del evento y devuelve el estado siguiente.
+ */
+
+typedef clock_state_t (*fsm_action_t)(fsm_t * self, const app_event_t * event);
+
+/**
+ * @brief Acción de entrada de un estado: parpadeo de dígitos y puntos.
+ */
+
+typedef struct {
+    uint8_t digits_from;
+    uint8_t digits_to;
+    uint16_t digits_divisor;
+    uint8_t points_from;
+    uint8_t points_to;
+    uint16_t points_divisor;
+} fsm_entry_t;
+
+/**
+ * @brief Campo BCD que se ajusta en un estado de edición.
+ */
+
+typedef struct {
+    uint16_t offset; //!< Posición del campo dentro de fsm_t
+    uint8_t modulo;  //!< Cantidad de valores del campo, 0 si el estado no edita nada
+} fsm_field_t;
+
+/* === Private function declarations =============================================================================== */
+
+static clock_state_t FsmIgnore(fsm_t * self, const app_event_t * event);
+
+static clock_state_t FsmStartSetTime(fsm_t * self, const app_event_t * event);
+
+static clock_state_t FsmStartSetAlarm(fsm_t * self, const app_event_t * event);
+
+static clock_state_t FsmToHours(fsm_t * self, const app_event_t * event);
+
+static clock_state_t FsmToAlarmHours(fsm_t * self, const app_event_t * event);
+
+static clock_state_t FsmAcceptTime(fsm_t * self, const app_event_t * event);
+
+static clock_state_t FsmAcceptAlarm(fsm_t * self, const app_event_t * event);
+
+static clock_state_t FsmAcceptNormal(fsm_t * self, const app_event_t * event);
+
+static clock_state_t FsmCancelNormal(fsm_t * self, const app_event_t * event);
+
+static clock_state_t FsmCancelSetTime(fsm_t * self, const app_event_t * event);
+
+static clock_state_t FsmToNormal(fsm_t * self, const app_event_t * event);
+
+static clock_state_t FsmAdjust(fsm_t * self, const app_event_t * event);
+
+static clock_state_t FsmClear(fsm_t * self, const app_event_t * event);
+
+static clock_state_t FsmAlarmCheck(fsm_t * self, const app_event_t * event);
+
+static clock_state_t FsmAlarmOff(fsm_t * self, const app_event_t * event);
+
+/**
+ * @brief Recuerda una alarma que llegó mientras se editaba, para hacerla sonar al volver al estado normal.
+ */
+
+static clock_state_t FsmAlarmDefer(fsm_t * self, const app_event_t * event);
+
+/**
+ * @brief Aplica la acción de entrada de un estado.
+ */
+
+static void FsmEnter(fsm_t * self, clock_state_t state);
+
+/* === Private variable definitions ================================================================================ */
+
+// clang-format off
+static const fsm_action_t FSM_TRANSITIONS[STATE_COUNT][EV_COUNT] = {
+    //                           EV_SET_TIME       EV_SET_ALARM      EV_ACCEPT        EV_CANCEL         EV_ADJUST  EV_CLEAR   EV_ALARM       EV_ALARM_OFF
+    [STATE_CLOCK_INIT]        = {FsmStartSetTime, FsmIgnore,        FsmIgnore,       FsmIgnore,        FsmIgnore, FsmIgnore, FsmIgnore,     FsmAlarmOff},
+    [STATE_NORMAL]            = {FsmStartSetTime, FsmStartSetAlarm, FsmAcceptNormal, FsmCancelNormal,  FsmIgnore, FsmIgnore, FsmAlarmCheck, FsmAlarmOff},
+    [STATE_SET_HOURS]         = {FsmIgnore,       FsmIgnore,        FsmAcceptTime,   FsmCancelSetTime, FsmAdjust, FsmClear,  FsmAlarmDefer, FsmAlarmOff},
+    [STATE_SET_MINUTES]       = {FsmIgnore,       FsmIgnore,        FsmToHours,      FsmCancelSetTime, FsmAdjust, FsmClear,  FsmAlarmDefer, FsmAlarmOff},
+    [STATE_SET_ALARM_HOURS]   = {FsmIgnore,       FsmIgnore,        FsmAcceptAlarm,  FsmToNormal,      FsmAdjust, FsmClear,  FsmAlarmDefer, FsmAlarmOff},
+    [STATE_SET_ALARM_MINUTES] = {FsmIgnore,       FsmIgnore,        FsmToAlarmHours, FsmToNormal,      FsmAdjust, FsmClear,  FsmAlarmDefer, FsmAlarmOff},
+};
+
+static const fsm_entry_t FSM_ENTRIES[STATE_COUNT] = {
+    //                           dígitos     puntos
+    [STATE_CLOCK_INIT]        = {0, 3, 100,  1, 1, 100},
+    [STATE_NORMAL]            = {0, 0, 0,    0, 0, 0},
+    [STATE_SET_HOURS]         = {0, 1, 50,   0, 3, 0},
+    [STATE_SET_MINUTES]       = {2, 3, 50,   0, 3, 0},
+    [STATE_SET_ALARM_HOURS]   = {0, 1, 50,   0, 3, 0},
+    [STATE_SET_ALARM_MINUTES] = {2, 3, 50,   0, 3, 0},
+};
+
+static const fsm_field_t FSM_FIELDS[STATE_COUNT] = {
+    [STATE_SET_HOURS]         = {offsetof(fsm_t, time_clock.time.hours), 24},
+    [STATE_SET_MINUTES]       = {offsetof(fsm_t, time_clock.time.minutes), 60},
+    [STATE_SET_ALARM_HOURS]   = {offsetof(fsm_t, time_alarm.time.hours), 24},
+    [STATE_SET_ALARM_MINUTES] = {offsetof(fsm_t, time_alarm.time.minutes), 60},
+};
+// clang-format on
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private function definitions ================================================================================ */
+
+static clock_state_t FsmIgnore(fsm_t * self, const app_event_t * event) {
+    (void)event;
+    return self->state;
+}
+
+static clock_state_t FsmStartSetTime(fsm_t * self, const app_event_t * event) {
+    (void)event;
+    ClockGetTime(self->clock, &self->time_clock);
+    return STATE_SET_MINUTES;
+}
+
+static clock_state_t FsmStartSetAlarm(fsm_t * self, const app_event_t * event) {
+    (void)event;
+    ClockGetAlarm(self->clock, &self->time_alarm);
+    return STATE_SET_ALARM_MINUTES;
+}
+
+static clock_state_t FsmToHours(fsm_t * self, const app_event_t * event) {
+    (void)self;
+    (void)event;
+    return STATE_SET_HOURS;
+}
+
+static clock_state_t FsmToAlarmHours(fsm_t * self, const app_event_t * event) {
+    (void)self;
+    (void)event;
+    return STATE_SET_ALARM_HOURS;
+}
+
+static clock_state_t FsmAcceptTime(fsm_t * self, const app_event_t * event) {
+    (void)event;
+    self->time_clock.time.seconds[0] = 0;
+    self->time_clock.time.seconds[1] = 0;
+    ClockSetTime(self->clock, &self->time_clock);
+    return STATE_NORMAL;
+}
+
+static clock_state_t FsmAcceptAlarm(fsm_t * self, const app_event_t * event) {
+    (void)event;
+    self->time_alarm.time.seconds[0] = 0;
+    self->time_alarm.time.seconds[1] = 0;
+    ClockSetAlarm(self->clock, &self->time_alarm);
+    ClockEnableAlarm(self->clock);
+    self->alarm_enabled = true;
+    return STATE_NORMAL;
+}
+
+static clock_state_t FsmAcceptNormal(fsm_t * self, const app_event_t * event) {
+    (void)event;
+    if (self->alarm_triggered) {
+        ClockPostponeAlarm(self->clock, FSM_SNOOZE_MINUTES);
+        self->alarm_triggered = false;
+        self->driver->AlarmOutput(false);
+    } else {
+        ClockEnableAlarm(self->clock);
+        self->alarm_enabled = true;
+    }
+    return STATE_NORMAL;
+}
+
+static clock_state_t FsmCancelNormal(fsm_t * self, const app_event_t * event) {
+    (void)event;
+    if (self->alarm_triggered) {
+        ClockCancelAlarmToday(self->clock);
+        self->alarm_triggered = false;
+        self->driver->AlarmOutput(false);
+    } else {
+        ClockDisableAlarm(self->clock);
+        self->alarm_enabled = false;
+    }
+    return STATE_NORMAL;
+}
+
+static clock_state_t FsmCancelSetTime(fsm_t * self, const app_event_t * event) {
+    (void)event;
+    // Si el reloj nunca se puso en hora se vuelve a la espera inicial
+    return ClockCancelSetTime(self->clock) ? STATE_CLOCK_INIT : STATE_NORMAL;
+}
+
+static clock_state_t FsmToNormal(fsm_t * self, const app_event_t * event) {
+    (void)self;
+    (void)event;
+    return STATE_NORMAL;
+}
+
+static clock_state_t FsmAdjust(fsm_t * self, const app_event_t * event) {
+    const fsm_field_t * field = &FSM_FIELDS[self->state];
+
+    ClockBcdAdjust((uint8_t *)self + field->offset, event->delta, field->modulo);
+    return self->state;
+}
+
+static clock_state_t FsmClear(fsm_t * self, const app_event_t * event) {
+    uint8_t * value = (uint8_t *)self + FSM_FIELDS[self->state].offset;
+    (void)event;
+
+    value[0] = 0;
+    value[1] = 0;
+    return self->state;
+}
+
+static clock_state_t FsmAlarmCheck(fsm_t * self, const app_event_t * event) {
+    (void)event;
+    if (!self->alarm_triggered && self->alarm_enabled && ClockAlarmMatchTheTime(self->clock)) {
+        self->alarm_triggered = true;
+        self->driver->AlarmOutput(true);
+    }
+    return self->state;
+}
+
+static clock_state_t FsmAlarmDefer(fsm_t * self, const app_event_t * event) {
+    (void)event;
+    // La cuenta regresiva del reloj avisa una sola vez: si se ignorara aquí, la alarma no sonaría ese día
+    self->alarm_pending = self->alarm_enabled;
+    return self->state;
+}
+
+static clock_state_t FsmAlarmOff(fsm_t * self, const app_event_t * event) {
+    (void)event;
+    self->alarm_triggered = false;
+    self->driver->AlarmOutput(false);
+    return self->state;
+}
+
+static void FsmEnter(fsm_t * self, clock_state_t state) {
+    const fsm_entry_t * entry = &FSM_ENTRIES[state];
+
+    self->state = state;
+    self->driver->FlashDigits(entry->digits_from, entry->digits_to, entry->digits_divisor);
+    self->driver->FlashPoints(entry->points_from, entry->points_to, entry->points_divisor);
+
+    if (state == STATE_NORMAL && self->alarm_pending) {
+        self->alarm_pending = false;
+        if (!self->alarm_triggered && self->alarm_enabled) {
+            self->alarm_triggered = true;
+            self->driver->AlarmOutput(true);
+        }
+    }
+}
+
+/* === Public function implementation ============================================================================== */
+
+void FsmInit(fsm_t * self, clock_t clock, fsm_driver_t driver) {
+    self->clock = clock;
+    self->driver = driver;
+    self->alarm_enabled = ClockIsAlarmEnabled(clock);
+    self->alarm_triggered = false;
+    self->alarm_pending = false;
+    ClockGetTime(clock, &self->time_clock);
+    ClockGetAlarm(clock, &self->time_alarm);
+    FsmEnter(self, STATE_CLOCK_INIT);
+}
+
+clock_state_t FsmDispatch(fsm_t * self, const app_event_t * event) {
+    if (event->type < EV_COUNT) {
+        clock_state_t next = FSM_TRANSITIONS[self->state][event->type](self, event);
+        if (next != self->state) {
+            FsmEnter(self, next);
+        }
+    }
+    return self->state;
+}
+
+bool FsmIsEditing(const fsm_t * self) {
+    return FSM_FIELDS[self->state].modulo != 0;
+}
+
+/* === End of documentation ======================================================================================== */
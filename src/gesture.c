@@ -0,0 +1,203 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Roldan JesusAlejandro <kechuroldanjesus@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+/** @file gesture.c
+ ** @brief Implementación del detector de gestos de las teclas.
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "gesture.h"
+#include <string.h>
+
+/* === Macros definitions ========================================================================================== */
+
+/* === Private data type declarations ============================================================================== */
+
+/* === Private function declarations =============================================================================== */
+
+/**
+ * @brief Agrega un evento a la lista si hay lugar.
+ */
+
+static void GestureEmit(gesture_event_t * events, uint8_t size, uint8_t * count, gesture_kind_t kind, uint8_t key,
+                        uint8_t steps);
+
+/**
+ * @brief Indica si ya se llegó a un momento, teniendo en cuenta el desborde del contador de tiempo.
+ */
+
+static bool GestureReached(uint32_t now, uint32_t moment);
+
+/* === Private variable definitions ================================================================================ */
+
+// Pasos de cada repetición según el nivel de aceleración
+static const uint8_t GESTURE_ACCEL_STEPS[] = {1, 2, 5, 10};
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private function definitions ================================================================================ */
+
+static void GestureEmit(gesture_event_t * events, uint8_t size, uint8_t * count, gesture_kind_t kind, uint8_t key,
+                        uint8_t steps) {
+    if (*count < size) {
+        events[*count].kind = kind;
+        events[*count].key = key;
+        events[*count].steps = steps;
+        (*count)++;
+    }
+}
+
+static bool GestureReached(uint32_t now, uint32_t moment) {
+    return (int32_t)(now - moment) >= 0;
+}
+
+/* === Public function implementation ============================================================================== */
+
+void GestureInit(gesture_t * self, uint32_t repeat_keys, uint32_t long_press_keys) {
+    memset(self, 0, sizeof(gesture_t));
+    self->repeat_keys = repeat_keys;
+    self->long_press_keys = long_press_keys & ~repeat_keys;
+}
+
+bool GestureAddChord(gesture_t * self, uint32_t keys) {
+    // Un acorde necesita al menos dos teclas
+    if (self->chord_count >= GESTURE_MAX_CHORDS || (keys & (keys - 1)) == 0) {
+        return false;
+    }
+    self->chords[self->chord_count++] = keys;
+    self->chord_keys |= keys;
+    return true;
+}
+
+uint8_t GestureUpdate(gesture_t * self, uint32_t state, uint32_t now, gesture_event_t * events, uint8_t size) {
+    uint32_t pressed = state & ~self->held;
+    uint32_t released = self->held & ~state;
+    uint8_t count = 0;
+
+    self->held = state;
+
+    for (uint8_t key = 0; key < GESTURE_MAX_KEYS; key++) {
+        uint32_t bit = 1u << key;
+
+        if (released & bit) {
+            // Un toque corto de una tecla de acorde se informa al soltarla
+            if (self->pending & bit) {
+                GestureEmit(events, size, &count, GESTURE_PRESS, key, 1);
+            }
+            self->pending &= ~bit;
+            self->consumed &= ~bit;
+            self->long_done &= ~bit;
+        }
+        if (pressed & bit) {
+            self->pressed_at[key] = now;
+            self->repeats[key] = 0;
+            if (self->chord_keys & bit) {
+                self->pending |= bit;
+            } else {
+                GestureEmit(events, size, &count, GESTURE_PRESS, key, 1);
+            }
+        }
+    }
+
+    for (uint8_t chord = 0; chord < self->chord_count; chord++) {
+        uint32_t keys = self->chords[chord];
+        if ((self->held & keys) == keys && (self->pending & keys) != 0 && (self->consumed & keys) == 0) {
+            GestureEmit(events, size, &count, GESTURE_CHORD, chord, 1);
+            self->consumed |= keys;
+            self->pending &= ~keys;
+        }
+    }
+
+    for (uint8_t key = 0; key < GESTURE_MAX_KEYS; key++) {
+        uint32_t bit = 1u << key;
+
+        if ((self->held & bit) == 0 || (self->consumed & bit) != 0) {
+            continue;
+        }
+        if (self->pending & bit) {
+            if (!GestureReached(now, self->pressed_at[key] + GESTURE_CHORD_MS)) {
+                continue;
+            }
+            self->pending &= ~bit;
+            GestureEmit(events, size, &count, GESTURE_PRESS, key, 1);
+        }
+
+        if ((self->long_done & bit) == 0) {
+            if (!GestureReached(now, self->pressed_at[key] + GESTURE_LONG_PRESS_MS)) {
+                continue;
+            }
+            self->long_done |= bit;
+            self->next_repeat[key] = self->pressed_at[key] + GESTURE_LONG_PRESS_MS;
+            if (self->long_press_keys & bit) {
+                GestureEmit(events, size, &count, GESTURE_LONG_PRESS, key, 1);
+            }
+        }
+
+        if (self->repeat_keys & bit) {
+            // Si la tarea se atrasó, todas las repeticiones vencidas se informan en un solo evento
+            uint16_t steps = 0;
+            while (GestureReached(now, self->next_repeat[key])) {
+                uint16_t level = self->repeats[key] / GESTURE_ACCEL_REPEATS;
+                if (level >= sizeof(GESTURE_ACCEL_STEPS) / sizeof(GESTURE_ACCEL_STEPS[0])) {
+                    level = sizeof(GESTURE_ACCEL_STEPS) / sizeof(GESTURE_ACCEL_STEPS[0]) - 1;
+                }
+                steps += GESTURE_ACCEL_STEPS[level];
+                self->repeats[key]++;
+                self->next_repeat[key] += GESTURE_REPEAT_MS;
+            }
+            if (steps != 0) {
+                GestureEmit(events, size, &count, GESTURE_REPEAT, key, steps > UINT8_MAX ? UINT8_MAX : steps);
+            }
+        }
+    }
+
+    return count;
+}
+
+uint32_t GestureDeadline(const gesture_t * self, uint32_t now) {
+    uint32_t deadline = GESTURE_NO_DEADLINE;
+    uint32_t active = self->held & ~self->consumed;
+
+    for (uint8_t key = 0; key < GESTURE_MAX_KEYS; key++) {
+        uint32_t bit = 1u << key;
+        uint32_t moment;
+
+        if ((active & bit) == 0) {
+            continue;
+        }
+        if (self->pending & bit) {
+            moment = self->pressed_at[key] + GESTURE_CHORD_MS;
+        } else if ((self->long_done & bit) == 0 && ((self->repeat_keys | self->long_press_keys) & bit)) {
+            moment = self->pressed_at[key] + GESTURE_LONG_PRESS_MS;
+        } else if ((self->long_done & bit) != 0 && (self->repeat_keys & bit)) {
+            moment = self->next_repeat[key];
+        } else {
+            continue;
+        }
+
+        uint32_t remaining = GestureReached(now, moment) ? 0 : moment - now;
+        if (remaining < deadline) {
+            deadline = remaining;
+        }
+    }
+    return deadline;
+}
+
+/* === End of documentation ======================================================================================== */
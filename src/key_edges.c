@@ -0,0 +1,100 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Roldan JesusAlejandro <kechuroldanjesus@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+/** @file key_edges.c
+ ** @brief Implementación de la cola de flancos de las teclas.
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "key_edges.h"
+#include <string.h>
+
+/* === Macros definitions ========================================================================================== */
+
+#define KEY_EDGES_MASK (KEY_EDGES_CAPACITY - 1)
+
+// Barrera entre escribir o leer un flanco y publicar el nuevo índice, igual que en clock.c
+#ifndef KEY_EDGES_MEMORY_BARRIER
+#define KEY_EDGES_MEMORY_BARRIER() __sync_synchronize()
+#endif
+
+/* === Private data type declarations ============================================================================== */
+
+/* === Private function declarations =============================================================================== */
+
+/* === Private variable definitions ================================================================================ */
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private function definitions ================================================================================ */
+
+/* === Public function implementation ============================================================================== */
+
+void KeyEdgesInit(key_edges_t * self) {
+    memset(self, 0, sizeof(key_edges_t));
+}
+
+bool KeyEdgesPush(key_edges_t * self, uint8_t key, bool active, uint32_t timestamp) {
+    uint16_t head = self->head;
+
+    if ((uint16_t)(head - self->tail) >= KEY_EDGES_CAPACITY) {
+        self->overruns++;
+        return false;
+    }
+
+    key_edge_t * edge = &self->buffer[head & KEY_EDGES_MASK];
+    edge->timestamp = timestamp;
+    edge->key = key;
+    edge->active = active;
+    KEY_EDGES_MEMORY_BARRIER();
+    self->head = head + 1;
+    return true;
+}
+
+bool KeyEdgesPop(key_edges_t * self, key_edge_t * edge) {
+    uint16_t tail = self->tail;
+
+    if (tail == self->head) {
+        return false;
+    }
+    KEY_EDGES_MEMORY_BARRIER();
+    *edge = self->buffer[tail & KEY_EDGES_MASK];
+    KEY_EDGES_MEMORY_BARRIER();
+    self->tail = tail + 1;
+    return true;
+}
+
+uint32_t KeyEdgesDrain(key_edges_t * self, uint32_t now) {
+    uint32_t keys = 0;
+    key_edge_t edge;
+
+    while (KeyEdgesPop(self, &edge)) {
+        // La resta sin signo sigue siendo correcta cuando el contador de ticks da la vuelta
+        uint32_t latency = now - edge.timestamp;
+        if (latency > self->max_latency) {
+            self->max_latency = latency;
+        }
+        keys |= 1u << edge.key;
+        self->drained++;
+    }
+    return keys;
+}
+
+/* === End of documentation ======================================================================================== */
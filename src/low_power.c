@@ -0,0 +1,80 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Roldan JesusAlejandro <kechuroldanjesus@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+/** @file low_power.c
+ ** @brief Implementación del modo de bajo consumo.
+ *
+ * Mientras el procesador duerme la base de tiempo del reloj queda suspendida: sigue contando, pero no interrumpe,
+ * así que el reposo solo termina por el tick de FreeRTOS programado o por otra interrupción. Al despertar la base de
+ * tiempo informa cuántos ticks pasaron y deja pendiente su interrupción, que los entrega de una vez al reloj
+ * (ClockAdvanceTicksAll) apenas FreeRTOS vuelve a habilitar las interrupciones. Así el reloj y sus observadores
+ * siempre corren en una interrupción, nunca desde la tarea ociosa.
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "low_power.h"
+#include "clock_task.h"
+#include <stddef.h>
+
+/* === Macros definitions ========================================================================================== */
+
+/* === Private data type declarations ============================================================================== */
+
+/* === Private function declarations =============================================================================== */
+
+/* === Private variable definitions ================================================================================ */
+
+static timebase_driver_t sleep_timebase = NULL;
+
+/* === Public variable definitions ================================================================================= */
+
+low_power_stats_t low_power_stats;
+
+/* === Private function definitions ================================================================================ */
+
+/* === Public function implementation ============================================================================== */
+
+void LowPowerInit(timebase_driver_t timebase) {
+    sleep_timebase = timebase;
+}
+
+void LowPowerSleepEnter(uint32_t expected_idle_ticks) {
+    (void)expected_idle_ticks;
+    if (sleep_timebase != NULL) {
+        sleep_timebase->Suspend();
+    }
+    low_power_stats.sleeps++;
+}
+
+void LowPowerSleepExit(uint32_t expected_idle_ticks) {
+    (void)expected_idle_ticks;
+    if (sleep_timebase != NULL) {
+        low_power_stats.asleep_ticks += sleep_timebase->Resume();
+    }
+}
+
+uint32_t LowPowerResidency(void) {
+    if (clock_timebase_stats.ticks == 0) {
+        return 0;
+    }
+    return (uint32_t)((uint64_t)low_power_stats.asleep_ticks * 1000u / clock_timebase_stats.ticks);
+}
+
+/* === End of documentation ======================================================================================== */
@@ -28,7 +28,6 @@ SPDX-License-Identifier: MIT
 #include "FreeRTOS.h"
 #include "task.h"
 #include "queue.h"
-#include "semphr.h"
 #include "clock_task.h"
 #include "button_task.h"
 
@@ -36,391 +35,208 @@ SPDX-License-Identifier: MIT
 #include "clock.h"
 #include "screen.h"
 #include "digital.h"
+#include "low_power.h"
+#include "event_bus.h"
+#include "fsm.h"
+#include "chip.h"
 
 /* === Macros definitions ====================================================================== */
 
 #define INACTIVITY_TIMEOUT_MS 30000      ///< 30 segundos
+#define ALARM_BLINK_GROUP 2              ///< Grupo de parpadeo del punto de la alarma
+#define ALARM_BLINK_PERIOD 40            ///< Imágenes por ciclo del punto de la alarma sonando
 
 /* === Private data type declarations ========================================================== */
 
-
-/**
- * @enum alarm_event_t
- * @brief Eventos internos de la tarea de alarma.
- */
-
-typedef enum {
-    ALARM_CHECK,
-    ALARM_ACTIVATE,
-    ALARM_DEACTIVATE
-} alarm_event_t;
-
 /* === Private variable declarations =========================================================== */
 
 static BoardT board;                                        /**< Instancia de la placa */
 static uint8_t decimal_points [4] = {0, 0, 0, 0};           /**< Estado de los puntos decimales del display */
-clock_time_t time_clock;                                    /**< Hora actual del reloj */
-static clock_time_t time_alarm;                             /**< Hora configurada de la alarma */
 clock_t clock;                                              /**< Variable del reloj simulado */
-clock_state_t state = STATE_CLOCK_INIT;                     /**< Estado actual de la máquina de estados del reloj */
+static fsm_t fsm;                                           /**< Máquina de estados de la interfaz */
 static bool show_dot = true;                                /**< Control de parpadeo de puntos decimales */
-static bool alarm_enabled = false;                          /**< Indica si la alarma está activada */
-static bool alarm_triggered = false;                        /**< Indica si la alarma está sonando */
-static QueueHandle_t xEvtQ;                                 /**< Cola de eventos de botones */
-SemaphoreHandle_t xStateMutex;                              /**< Mutex para proteger estado compartido */
-static TaskHandle_t xAlarmTaskHandle = NULL;                /**< Handle de la tarea de alarma */    
-static QueueHandle_t xAlarmQueue = NULL;                    /**< Cola de eventos de alarma */    
 static TickType_t last_input_tick = 0;                      /**< Último tick de interacción del usuario */
 
 /* === Private function declarations =========================================================== */
 
-/**
- * @brief Incrementa un número BCD con ajuste para horas o minutos.
- * @param numero Array de 2 elementos con el número BCD (unidades, decenas)
- * @param is_hours True si es valor de horas, false si es minutos
- */
+static void FsmFlashDigits(uint8_t from, uint8_t to, uint16_t divisor);
 
-void UpBCDAdjusted(uint8_t numero[2], bool is_hours);
+static void FsmFlashPoints(uint8_t from, uint8_t to, uint16_t divisor);
 
-/**
- * @brief Decrementa un número BCD con ajuste para horas o minutos.
- * @param numero Array de 2 elementos con el número BCD (unidades, decenas)
- * @param is_hours True si es valor de horas, false si es minutos
- */
+static void FsmAlarmOutput(bool on);
 
-void DownBCDAdjusted(uint8_t numero[2], bool is_hours);
+static void DisplayCompose(void);
 
 /* === Public variable definitions ============================================================= */
 
 /* === Private variable definitions ============================================================ */
 
+/** @brief Efectos de la máquina de estados sobre la pantalla y la salida de la alarma */
+static const struct fsm_driver_s fsm_driver = {
+    .FlashDigits = FsmFlashDigits,
+    .FlashPoints = FsmFlashPoints,
+    .AlarmOutput = FsmAlarmOutput,
+};
+
 /* === Private function implementation ========================================================= */
 
-/**
- * @brief Maneja la tarea de alarma.
- * @param pvParameters Parámetros de la tarea (no utilizados)
- */
+static void FsmFlashDigits(uint8_t from, uint8_t to, uint16_t divisor) {
+    DisplayFlashDigits(board->screen, from, to, divisor);
+}
 
-static void vAlarmTask(void *pvParameters) {
-    alarm_event_t event;
-    
-    while(1) {
-        if(xQueueReceive(xAlarmQueue, &event, pdMS_TO_TICKS(1000)) == pdPASS) {
-            switch(event) {
-                case ALARM_CHECK:
-                    if(!alarm_triggered && alarm_enabled && 
-                       ClockAlarmMatchTheTime(clock) && (state == STATE_NORMAL)) {
-                        alarm_triggered = true;
-                        DigitalOutputActivate(board->led_green);
-                    }
-                    break;
-                    
-                case ALARM_ACTIVATE:
-                    alarm_triggered = true;
-                    DigitalOutputActivate(board->led_green);
-                    break;
-                    
-                case ALARM_DEACTIVATE:
-                    alarm_triggered = false;
-                    DigitalOutputDeactivate(board->led_green);
-                    break;
-            }
-        }
-    }
+static void FsmFlashPoints(uint8_t from, uint8_t to, uint16_t divisor) {
+    DisplayFlashPoints(board->screen, from, to, divisor);
 }
 
-/**
- * @brief Maneja los eventos de la alarma (verificación, activación, desactivación).
- */
-void HandleAlarm(void) {
-    alarm_event_t event = ALARM_CHECK;
-    xQueueSend(xAlarmQueue, &event, 0);
+static void FsmAlarmOutput(bool on) {
+    if (on) {
+        DigitalOutputActivate(board->led_green);
+    } else {
+        DigitalOutputDeactivate(board->led_green);
+    }
+    // Mientras suena, el punto de la alarma parpadea más rápido que el de los segundos, en su propio grupo
+    ScreenBlink(board->screen, ALARM_BLINK_GROUP, 0, 1u << 3, on ? ALARM_BLINK_PERIOD : 0, 0);
 }
 
 /**
- * @brief Cancela la alarma actual.
+ * @brief Compone la imagen de la pantalla según el estado del reloj y la publica.
+ *
+ * Se llama desde la máquina de estados solo cuando cambia algo de lo que se muestra: después de un evento o en el
+ * cambio de segundo fuera de los estados de edición. Esta tarea es la única que toca el estado de la interfaz, así
+ * que no hace falta un mutex; el multiplexado lee la imagen publicada sin bloquear.
  */
 
-void CancelAlarm(void) {
-    alarm_event_t event = ALARM_DEACTIVATE;
-    xQueueSend(xAlarmQueue, &event, 0);
+static void DisplayCompose(void) {
+    if (fsm.state == STATE_SET_HOURS || fsm.state == STATE_SET_MINUTES) {
+        ScreenWriteBCD(board->screen, &fsm.time_clock, false, (uint8_t[]){0, 0, 0, 0});
+    } else if (fsm.state == STATE_SET_ALARM_HOURS || fsm.state == STATE_SET_ALARM_MINUTES) {
+        ScreenWriteBCD(board->screen, &fsm.time_alarm, false, (uint8_t[]){1, 1, 1, 1});
+    } else {
+        // STATE_NORMAL / INIT: la hora se lee del reloj, time_clock solo guarda lo que se está editando
+        clock_time_t now;
+        ClockGetTime(clock, &now);
+        decimal_points[1] = (fsm.state == STATE_NORMAL) ? (show_dot ? 1 : 0) : 1;
+        decimal_points[3] = ClockIsAlarmEnabled(clock) ? 1 : 0;
+        ScreenWriteBCD(board->screen, &now, false, decimal_points);
+    }
 }
 
 /**
- * @brief Maneja los diferentes estados de la máquina de estados del reloj.
- * @param mode Estado a establecer
+ * @brief Entrega un evento a la máquina de estados.
+ * @param ev Evento a atender
  */
 
-void ClockStates(clock_state_t mode) {
-
-    state = mode;
-
-    switch (state) {
-    case STATE_CLOCK_INIT:
-
-        DisplayFlashDigits(board->screen, 0, 3, 100);
-        DisplayFlashPoints(board->screen, 1, 1, 100);
-
-        break;
-
-    case STATE_NORMAL:
-
-        DisplayFlashDigits(board->screen, 0, 0, 0);
-        DisplayFlashPoints(board->screen, 0, 0, 0);
-        break;
-
-    case STATE_SET_HOURS:
-
-        DisplayFlashDigits(board->screen, 0, 1, 50);
-        DisplayFlashPoints(board->screen, 0, 3, 0);
-        break;
-
-    case STATE_SET_MINUTES:
-
-        DisplayFlashDigits(board->screen, 2, 3, 50);
-        DisplayFlashPoints(board->screen, 0, 3, 0);
-        break;
-
-    case STATE_SET_ALARM_HOURS:
-        DisplayFlashDigits(board->screen, 0, 1, 50);
-        DisplayFlashPoints(board->screen, 0, 3, 0);
-        break;
-
-    case STATE_SET_ALARM_MINUTES:
-
-        DisplayFlashDigits(board->screen, 2, 3, 50);
-        DisplayFlashPoints(board->screen, 0, 3, 0);
-
-        break;
-    }
+static void StateMachineDispatch(app_event_t ev) {
+    // El reloj avanza y la pantalla parpadea desde interrupciones: mientras la máquina de estados modifica el reloj
+    // o llama a ScreenBlink no puede llegar un tick ni un paso del multiplexado
+    taskENTER_CRITICAL();
+    FsmDispatch(&fsm, &ev);
+    taskEXIT_CRITICAL();
+    DisplayCompose();
 }
 
-static void vStateMachineTask(void *pvParameters) {
-    app_event_t ev;
-
-    ClockStates(STATE_CLOCK_INIT);
-    if (xSemaphoreTake(xStateMutex, portMAX_DELAY)) {
-        ClockGetTime(clock, &time_clock);
-        ClockGetAlarm(clock, &time_alarm);
-        xSemaphoreGive(xStateMutex);
-    }
-
-    for (;;) {
-        if (xQueueReceive(xEvtQ, &ev, portMAX_DELAY)) {
-
-            if (xSemaphoreTake(xStateMutex, portMAX_DELAY)) {
-
-                switch (ev.type) {
-                case EV_SET_TIME:
-                    if (state == STATE_NORMAL || state == STATE_CLOCK_INIT) {
-                        ClockGetTime(clock, &time_clock);
-                        ClockStates(STATE_SET_MINUTES);
-                    }
-                    
-                    break;
-
-                case EV_SET_ALARM:
-                    if (state == STATE_NORMAL) {
-                        ClockGetAlarm(clock, &time_alarm);
-                        ClockStates(STATE_SET_ALARM_MINUTES);
-                    }
-                    break;
-
-                case EV_ACCEPT:
-                    if (state == STATE_SET_MINUTES) {
-                        ClockStates(STATE_SET_HOURS);
-                    } else if (state == STATE_SET_HOURS) {
-                        time_clock.time.seconds[0] = 0; time_clock.time.seconds[1] = 0;
-                        ClockSetTime(clock, &time_clock);
-                        ClockStates(STATE_NORMAL);
-                    } else if (state == STATE_SET_ALARM_MINUTES) {
-                        ClockStates(STATE_SET_ALARM_HOURS);
-                    } else if (state == STATE_SET_ALARM_HOURS) {
-                        time_alarm.time.seconds[0] = 0; time_alarm.time.seconds[1] = 0;
-                        ClockSetAlarm(clock, &time_alarm);
-                        ClockEnableAlarm(clock);
-                        alarm_enabled = true;
-                        ClockStates(STATE_NORMAL);
-                    } else if (state == STATE_NORMAL && alarm_triggered) {
-                        ClockPostponeAlarm(clock, 5);
-                        alarm_triggered = false;
-                        DigitalOutputDeactivate(board->led_green);
-                    } else if (state == STATE_NORMAL && !alarm_triggered) {
-                        ClockEnableAlarm(clock);
-                        alarm_enabled = true;
-                        decimal_points[3] = 1;
-                    }
-                    break;
-
-                case EV_CANCEL:
-                    if (state == STATE_NORMAL && alarm_triggered) {
-                        ClockCancelAlarmToday(clock);
-                        alarm_triggered = false;
-                        decimal_points[3] = 1;
-                        DigitalOutputDeactivate(board->led_green);
-                    } else if (state == STATE_NORMAL && !alarm_triggered) {
-                        ClockDisableAlarm(clock);
-                        alarm_enabled = false;
-                        decimal_points[3] = 0;
-                    } else if (state == STATE_SET_ALARM_HOURS || state == STATE_SET_ALARM_MINUTES) {
-                        ClockStates(STATE_NORMAL);
-                    } else if (state == STATE_SET_HOURS || state == STATE_SET_MINUTES){
-
-                        if (!ClockCancelSetTime(clock)) {
-                           
-                            ClockStates(STATE_NORMAL);
-                            
-                        }else {
-                            ClockStates(STATE_CLOCK_INIT);
-                        }
-                        
-                    }
-                    break;
-
-                case EV_INCREMENT:
-                    if (state == STATE_SET_HOURS) {
-                        UpBCDAdjusted(time_clock.time.hours, true);
-                    } else if (state == STATE_SET_MINUTES) {
-                        UpBCDAdjusted(time_clock.time.minutes, false);
-                    } else if (state == STATE_SET_ALARM_HOURS) {
-                        UpBCDAdjusted(time_alarm.time.hours, true);
-                    } else if (state == STATE_SET_ALARM_MINUTES) {
-                        UpBCDAdjusted(time_alarm.time.minutes, false);
-                    }
-                    break;
-
-                case EV_DECREMENT:
-                    if (state == STATE_SET_HOURS) {
-                        DownBCDAdjusted(time_clock.time.hours, true);
-                    } else if (state == STATE_SET_MINUTES) {
-                        DownBCDAdjusted(time_clock.time.minutes, false);
-                    } else if (state == STATE_SET_ALARM_HOURS) {
-                        DownBCDAdjusted(time_alarm.time.hours, true);
-                    } else if (state == STATE_SET_ALARM_MINUTES) {
-                        DownBCDAdjusted(time_alarm.time.minutes, false);
-                    }
-                    break;
-                }
+/**
+ * @brief Avisa en el bus cada cambio de segundo, para el parpadeo del punto. Se llama desde la interrupción del reloj.
+ */
 
-                xSemaphoreGive(xStateMutex);
-            }
+static void SecondObserver(clock_t self, uint8_t edges, void * context) {
+    BaseType_t higher_priority_woken = pdFALSE;
+    (void)self;
+    (void)edges;
+    (void)context;
 
-            // manejo de alarma (sin bloquear mutex mucho tiempo)
-            if (!alarm_triggered && alarm_enabled && ClockAlarmMatchTheTime(clock) && state == STATE_NORMAL) {
-                alarm_triggered = true;
-                DigitalOutputActivate(board->led_green);
-            }
-        }
-    }
+    EventBusPostFromISR(EVENT_BUS_SECOND, &higher_priority_woken);
+    portYIELD_FROM_ISR(higher_priority_woken);
 }
 
 /**
- * @brief Incrementa un número BCD con ajuste para horas o minutos
- * @param numero Array de 2 elementos con el número BCD (unidades, decenas)
- * @param is_hours Indica si es un valor de horas (ajusta a 23) o minutos (ajusta a 59)
+ * @brief Avisa en el bus que hay que verificar la coincidencia de la alarma con la hora.
+ *
+ * La interrupción de la base de tiempo la llama una sola vez, cuando la cuenta regresiva de la alarma llega a cero.
  */
-
-void UpBCDAdjusted(uint8_t numero[2], bool is_hours) {
-    uint8_t temp[2] = {numero[1], numero[0]}; // Invertimos para trabajar
-    
-    // Incrementamos como decimal normal
-    uint16_t value = temp[0] * 10 + temp[1];
-    value = (value + 1) % (is_hours ? 24 : 60);
-    
-    // Convertimos de vuelta a BCD invertido
-    temp[0] = value / 10; // Decenas
-    temp[1] = value % 10; // Unidades
-    
-    numero[0] = temp[1]; // Restauramos orden original
-    numero[1] = temp[0];
+void HandleAlarmFromISR(BaseType_t * higher_priority_woken) {
+    EventBusPostFromISR(EVENT_BUS_ALARM, higher_priority_woken);
 }
 
 /**
- * @brief Decrementa un número BCD con ajuste para horas o minutos
- * @param numero Array de 2 elementos con el número BCD (unidades, decenas)
- * @param is_hours Indica si es un valor de horas (ajusta a 23) o minutos (ajusta a 59)
+ * @brief Cancela la alarma actual.
  */
 
-void DownBCDAdjusted(uint8_t numero[2], bool is_hours) {
-    uint8_t temp[2] = {numero[1], numero[0]}; // Invertimos
-    
-    uint16_t value = temp[0] * 10 + temp[1];
-    value = (value == 0) ? (is_hours ? 23 : 59) : value - 1;
-    
-    temp[0] = value / 10;
-    temp[1] = value % 10;
-    
-    numero[0] = temp[1];
-    numero[1] = temp[0];
+void CancelAlarm(void) {
+    EventBusPost(EVENT_BUS_ALARM_OFF);
 }
 
 /**
- * @brief Actualiza la pantalla según el estado del reloj y los valores actuales.
+ * @brief Indica cuánto puede esperar el consumidor del bus antes de cancelar la edición por inactividad.
+ * @return Ticks hasta el vencimiento, o portMAX_DELAY si no se está editando
  */
 
-static void vRefreshScreenTask(void *pvParameters) {
-    for (;;) {
-        if (xSemaphoreTake(xStateMutex, portMAX_DELAY)) {
-
-            ScreenRefresh(board->screen);
-
-            if (state == STATE_SET_HOURS || state == STATE_SET_MINUTES) {
-                ScreenWriteBCD(board->screen, &time_clock, false, (uint8_t[]){0, 0, 0, 0});
-            } else if (state == STATE_SET_ALARM_HOURS || state == STATE_SET_ALARM_MINUTES) {
-                ScreenWriteBCD(board->screen, &time_alarm, false, (uint8_t[]){1, 1, 1, 1});
-            } else {
-                // STATE_NORMAL / INIT
-                decimal_points[1] = (state == STATE_NORMAL) ? (show_dot ? 1 : 0) : 1;
-                decimal_points[3] = ClockIsAlarmEnabled(clock) ? 1 : 0;
-                ScreenWriteBCD(board->screen, &time_clock, false, decimal_points);
-            }
-
-            xSemaphoreGive(xStateMutex);
-        }
+static TickType_t InactivityWait(void) {
+    if (!FsmIsEditing(&fsm)) {
+        return portMAX_DELAY;
+    }
 
-        vTaskDelay(pdMS_TO_TICKS(3));
+    TickType_t elapsed = xTaskGetTickCount() - last_input_tick;
+    if (elapsed >= pdMS_TO_TICKS(INACTIVITY_TIMEOUT_MS)) {
+        return 0;
     }
+    return pdMS_TO_TICKS(INACTIVITY_TIMEOUT_MS) - elapsed;
 }
 
 /**
- * @brief Controla el parpadeo de los puntos decimales en pantalla.
+ * @brief Único consumidor del bus de eventos: atiende alarmas, teclas, inactividad y el parpadeo del punto, en ese
+ * orden de prioridad.
  */
 
-static void vDotTask(void *pvParameters) {
-    for (;;) {
-        if (xSemaphoreTake(xStateMutex, portMAX_DELAY)) {
-            if (state == STATE_NORMAL) {
-                show_dot = !show_dot;
-            } else {
-                show_dot = true; // o como prefieras en INIT
-            }
-            xSemaphoreGive(xStateMutex);
-        }
-        vTaskDelay(pdMS_TO_TICKS(1000));
-    }
-}
+static void vStateMachineTask(void *pvParameters) {
+    app_event_t ev;
+
+    // FsmInit ya configura el parpadeo y el multiplexado está en marcha, igual que en StateMachineDispatch
+    taskENTER_CRITICAL();
+    FsmInit(&fsm, clock, &fsm_driver);
+    taskEXIT_CRITICAL();
+    DisplayCompose();
 
+    for (;;) {
+        uint32_t pending = EventBusWait(InactivityWait());
+
+        while (pending != 0) {
+            switch (EventBusNext(&pending)) {
+            case EVENT_BUS_ALARM_OFF:
+                StateMachineDispatch((app_event_t){.type = EV_ALARM_OFF});
+                break;
+
+            case EVENT_BUS_ALARM:
+                StateMachineDispatch((app_event_t){.type = EV_ALARM});
+                break;
+
+            case EVENT_BUS_KEY:
+                while (EventBusReceiveKey(&ev)) {
+                    last_input_tick = xTaskGetTickCount();
+                    StateMachineDispatch(ev);
+                }
+                break;
 
+            case EVENT_BUS_TIMEOUT:
+                // Sin teclas durante INACTIVITY_TIMEOUT_MS se abandona la edición, como con la tecla cancelar
+                if (InactivityWait() == 0) {
+                    last_input_tick = xTaskGetTickCount();
+                    StateMachineDispatch((app_event_t){.type = EV_CANCEL});
+                }
+                break;
 
+            case EVENT_BUS_SECOND:
+                // En los estados de edición se muestra lo que se edita, que solo cambia con las teclas
+                if (!FsmIsEditing(&fsm)) {
+                    show_dot = (fsm.state == STATE_NORMAL) ? !show_dot : true;
+                    DisplayCompose();
+                }
+                break;
 
-static void vInactivityTask(void *pvParameters) {
-    for (;;) {
-        TickType_t now = xTaskGetTickCount();
-        
-        // Solo considerar estados de edición
-        if ((state == STATE_SET_MINUTES || state == STATE_SET_HOURS ||
-             state == STATE_SET_ALARM_MINUTES || state == STATE_SET_ALARM_HOURS) &&
-            (now - last_input_tick >= pdMS_TO_TICKS(INACTIVITY_TIMEOUT_MS))) {
-            
-            // Enviar evento CANCEL solo si la cola no está llena
-            app_event_t ev = { .type = EV_CANCEL };
-            xQueueSend(xEvtQ, &ev, 0);
-            
-            // Actualizamos last_input_tick para evitar enviar continuamente
-            last_input_tick = now;
+            default:
+                break;
+            }
         }
-
-        vTaskDelay(pdMS_TO_TICKS(100)); // chequear cada 100 ms
     }
 }
 
@@ -435,31 +251,37 @@ int main(void) {
     
     //clock_time_t time_alarm;
     // Inicializar hardware
+    // Sin memoria para algún objeto o tarea el reloj no puede funcionar: configASSERT detiene el sistema ahí
     board = BoardCreate();
-   
-    xEvtQ = xQueueCreate(10, sizeof(app_event_t));
-    xStateMutex = xSemaphoreCreateMutex();
-    xAlarmQueue = xQueueCreate(5, sizeof(alarm_event_t));
-    ButtonTaskInit(board, xEvtQ);
+    configASSERT(board != NULL);
 
+    // La máquina de estados es el único consumidor del bus de eventos: teclas, alarma, inactividad y segundos
+    TaskHandle_t fsm_task = NULL;
+    BaseType_t created =
+        xTaskCreate(vStateMachineTask, "FSM", configMINIMAL_STACK_SIZE, NULL, tskIDLE_PRIORITY + 2, &fsm_task);
+    configASSERT(created == pdPASS);
+    bool started = EventBusInit(fsm_task);
+    configASSERT(started);
+    ButtonTaskInit(board);
+
+
+    // El reloj avanza desde la base de tiempo de la placa; el SysTick queda para FreeRTOS
+    clock = ClockCreate(CLOCK_TICKS_PER_SECOND);
+    configASSERT(clock != NULL);
 
-    // Crear reloj con 1000 ticks por segundo
-    clock = ClockCreate(1000);
-    
-    SysTickInit(1000); // Configurar SysTick para 1ms
     // Configurar hora inicial
-    ClockGetTime(clock, &time_clock);
-    ClockGetAlarm(clock,&time_alarm);
     ClockDisableAlarm(clock);
+    started = ClockAddObserver(clock, CLOCK_EDGE_SECOND, SecondObserver, NULL);
+    configASSERT(started);
+    started = ClockTaskStart(board->timebase);
+    configASSERT(started);
+    LowPowerInit(board->timebase);
 
     
-    // Tareas y prioridades
-    xTaskCreate(vAlarmTask,         "Alarm",    configMINIMAL_STACK_SIZE, NULL, tskIDLE_PRIORITY + 2, &xAlarmTaskHandle);
-    xTaskCreate(vRefreshScreenTask, "Refresh",  configMINIMAL_STACK_SIZE, NULL, tskIDLE_PRIORITY + 4, NULL);
-    xTaskCreate(vClockTask,         "Clock",    configMINIMAL_STACK_SIZE, NULL, tskIDLE_PRIORITY + 3, NULL);
-    xTaskCreate(vStateMachineTask,  "FSM",      configMINIMAL_STACK_SIZE, NULL, tskIDLE_PRIORITY + 2, NULL);
-    xTaskCreate(vDotTask,           "Dot",      configMINIMAL_STACK_SIZE, NULL, tskIDLE_PRIORITY + 1, NULL);
-    xTaskCreate(vInactivityTask, "Inactivity",  configMINIMAL_STACK_SIZE, NULL, tskIDLE_PRIORITY + 1, NULL);
+    // La pantalla se multiplexa desde la interrupción de su temporizador: muestra la imagen publicada por la
+    // máquina de estados
+    started = ScreenStart(board->screen, board->display_timer, SCREEN_FRAME_RATE_HZ);
+    configASSERT(started);
     vTaskStartScheduler();
     
     while(1);
@@ -0,0 +1,176 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Roldan JesusAlejandro <kechuroldanjesus@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+/** @file max7219.c
+ ** @brief Controlador de pantalla para controladores serie de siete segmentos tipo MAX7219, encadenados.
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "max7219.h"
+#include <stddef.h>
+#include <string.h>
+
+/* === Macros definitions ========================================================================================== */
+
+/** @brief Registros de los controladores */
+#define MAX7219_REG_DIGIT_0      0x01 //!< Primer dígito; los siguientes están a continuación
+#define MAX7219_REG_DECODE_MODE  0x09
+#define MAX7219_REG_INTENSITY    0x0A
+#define MAX7219_REG_SCAN_LIMIT   0x0B
+#define MAX7219_REG_SHUTDOWN     0x0C
+#define MAX7219_REG_DISPLAY_TEST 0x0F
+
+/** @brief Bit del punto decimal en los registros de dígito */
+#define MAX7219_POINT 0x80
+
+/* === Private data type declarations ============================================================================== */
+
+/* === Private function declarations =============================================================================== */
+
+/**
+ * @brief Envía un valor a un registro de cada controlador y los copia a todos con un solo pulso de carga.
+ *
+ * @param reg Registro a escribir
+ * @param values Valor para cada controlador, empezando por el más cercano al procesador
+ */
+
+static void Max7219Send(uint8_t reg, const uint8_t values[]);
+
+/**
+ * @brief Escribe el mismo valor en un registro de todos los controladores.
+ */
+
+static void Max7219SendAll(uint8_t reg, uint8_t value);
+
+/**
+ * @brief Pasa los segmentos del orden de la pantalla (A en el bit 0) al de los controladores (A en el bit 6).
+ */
+
+static uint8_t Max7219Encode(uint8_t segments);
+
+/**
+ * @brief Función WriteFrame del controlador de pantalla: envía solo los dígitos que cambiaron.
+ */
+
+static void Max7219WriteFrame(const uint8_t segments[], uint8_t digits);
+
+/* === Private variable definitions ================================================================================ */
+
+static const struct screen_driver_s max7219_driver = {
+    .WriteFrame = Max7219WriteFrame,
+};
+
+static max7219_bus_t max7219_bus = NULL;
+static uint8_t max7219_chips = 0;
+static uint8_t max7219_digits_per_chip = 0;
+static uint8_t max7219_shown[MAX7219_CHIP_DIGITS][MAX7219_MAX_CHIPS]; //!< Lo que tiene cada registro de dígito
+static max7219_stats_t max7219_stats;
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private function definitions ================================================================================ */
+
+static void Max7219Send(uint8_t reg, const uint8_t values[]) {
+    max7219_bus->Load(false);
+    // Lo primero que entra termina en el controlador más lejano
+    for (uint8_t chip = max7219_chips; chip-- > 0;) {
+        uint16_t word = (uint16_t)reg << 8 | values[chip];
+        for (uint16_t bit = 0x8000; bit != 0; bit >>= 1) {
+            max7219_bus->Data((word & bit) != 0);
+            max7219_bus->Clock(true);
+            max7219_bus->Clock(false);
+        }
+    }
+    max7219_bus->Load(true);
+    max7219_stats.loads++;
+    max7219_stats.bits += 16u * max7219_chips;
+}
+
+static void Max7219SendAll(uint8_t reg, uint8_t value) {
+    uint8_t values[MAX7219_MAX_CHIPS];
+
+    memset(values, value, sizeof(values));
+    Max7219Send(reg, values);
+}
+
+static uint8_t Max7219Encode(uint8_t segments) {
+    uint8_t encoded = segments & SEGMENT_P ? MAX7219_POINT : 0;
+
+    for (uint8_t segment = 0; segment < 7; segment++) {
+        if (segments & (1u << segment)) {
+            encoded |= 1u << (6 - segment);
+        }
+    }
+    return encoded;
+}
+
+static void Max7219WriteFrame(const uint8_t segments[], uint8_t digits) {
+    max7219_stats.frames++;
+
+    // Cada carga escribe el mismo dígito en todos los controladores: se envía solo si alguno cambió
+    for (uint8_t row = 0; row < max7219_digits_per_chip; row++) {
+        uint8_t values[MAX7219_MAX_CHIPS];
+        bool changed = false;
+
+        for (uint8_t chip = 0; chip < max7219_chips; chip++) {
+            uint8_t digit = chip * max7219_digits_per_chip + row;
+            values[chip] = (digit < digits) ? Max7219Encode(segments[digit]) : 0;
+            changed |= values[chip] != max7219_shown[row][chip];
+        }
+        if (changed) {
+            Max7219Send(MAX7219_REG_DIGIT_0 + row, values);
+            memcpy(max7219_shown[row], values, max7219_chips);
+        }
+    }
+}
+
+/* === Public function implementation ============================================================================== */
+
+screen_driver_t Max7219Create(max7219_bus_t bus, uint8_t chips, uint8_t digits_per_chip) {
+    if (!bus || chips == 0 || chips > MAX7219_MAX_CHIPS || digits_per_chip == 0 ||
+        digits_per_chip > MAX7219_CHIP_DIGITS) {
+        return NULL;
+    }
+    max7219_bus = bus;
+    max7219_chips = chips;
+    max7219_digits_per_chip = digits_per_chip;
+    memset(&max7219_stats, 0, sizeof(max7219_stats));
+
+    // Reposo: reloj bajo y carga alta, para que el primer flanco de carga sea el del primer envío
+    bus->Clock(false);
+    bus->Load(true);
+
+    Max7219SendAll(MAX7219_REG_DISPLAY_TEST, 0);
+    Max7219SendAll(MAX7219_REG_DECODE_MODE, 0);
+    Max7219SendAll(MAX7219_REG_SCAN_LIMIT, digits_per_chip - 1);
+    Max7219SendAll(MAX7219_REG_INTENSITY, MAX7219_INTENSITY & 0x0F);
+    for (uint8_t row = 0; row < digits_per_chip; row++) {
+        Max7219SendAll(MAX7219_REG_DIGIT_0 + row, 0);
+    }
+    memset(max7219_shown, 0, sizeof(max7219_shown));
+    Max7219SendAll(MAX7219_REG_SHUTDOWN, 1);
+    return &max7219_driver;
+}
+
+const max7219_stats_t * Max7219Stats(void) {
+    return &max7219_stats;
+}
+
+/* === End of documentation ======================================================================================== */
@@ -31,27 +31,62 @@ SPDX-License-Identifier: MIT
 
 /* === Macros definitions ========================================================================================== */
 
-#ifndef SCREEN_MAX_DIGITS
-#define SCREEN_MAX_DIGITS 8
+/** @brief Impide que el compilador mueva escrituras de la imagen de trabajo después de publicarla */
+#define SCREEN_BARRIER() __asm__ volatile("" ::: "memory")
+
+/** @brief Valor BCD que apaga un dígito */
+#define SCREEN_BLANK 0xFF
+
+// Las máscaras de puntos y la clave de ScreenWriteLayout tienen un bit y un nibble por dígito
+#if SCREEN_MAX_DIGITS > 8
+#error "SCREEN_MAX_DIGITS no puede ser mayor que 8"
 #endif
 
 /* === Private data type declarations ============================================================================== */
 
+/**
+ * @brief Dígitos BCD y puntos con que se codificó una imagen, para volver a codificar solo lo que cambia.
+ */
+
+typedef struct {
+    uint8_t digits[SCREEN_MAX_DIGITS]; //! <- valor BCD de cada dígito, SCREEN_BLANK si está apagado
+    uint8_t points;                    //! <- máscara de puntos decimales encendidos
+    uint8_t size;                      //! <- cantidad de dígitos escritos, los siguientes están apagados
+    bool valid;                        //! <- false si la imagen se compuso a mano con ScreenBeginFrame
+} screen_shadow_t;
+
+/**
+ * @brief Grupo de parpadeo. ScreenBlink escribe la configuración y el multiplexado es el único que avanza la cuenta.
+ */
+
+typedef struct {
+    uint16_t digits;          //! <- máscara de dígitos del grupo
+    uint16_t points;          //! <- máscara de puntos del grupo
+    uint16_t hidden_frames;   //! <- imágenes que dura la mitad oculta, 0 si el grupo está detenido
+    uint16_t visible_frames;  //! <- imágenes que dura la mitad visible
+    uint16_t phase;           //! <- imagen del ciclo con que empieza el grupo
+    uint16_t countdown;       //! <- imágenes que faltan para cambiar de mitad
+    bool hidden;              //! <- true durante la mitad oculta
+    volatile bool restart;    //! <- ScreenBlink cambió la configuración, se aplica en la próxima imagen
+} screen_blink_t;
+
 struct ScreenS {
     uint8_t digits;      //! <- cantidad de digitos de la pantalla
-    uint8_t flashing_to; //! <- segmentos de la pantalla
     uint8_t current_digit;
-    uint8_t flashing_from;
-    uint8_t flashing_count;
-    uint16_t flashing_frecuency;
-    // flashing punto decimal
-    uint8_t decimal_points_count;
-    uint8_t decimal_points_from;
-    uint8_t decimal_points_to;
-    uint16_t decimal_points_frecuency;
+    screen_blink_t blink[SCREEN_BLINK_GROUPS];       //! <- grupos de parpadeo
+    uint32_t visible_segments[SCREEN_MAX_DIGITS];    //! <- máscara de segmentos de cada dígito en esta imagen
+    uint32_t visible_points[SCREEN_MAX_DIGITS];      //! <- máscara del punto de cada dígito en esta imagen
     screen_driver_t driver;                          //! <- driver de la pantalla
-    uint8_t value[SCREEN_MAX_DIGITS];                //! <- valores a mostrar en la pantalla
-    uint8_t value_decimal_points[SCREEN_MAX_DIGITS]; //! <- puntos decimales para cada dígito
+    screen_frame_t frames[2];                        //! <- imagen que se muestra e imagen de trabajo
+    screen_shadow_t shadows[2];                      //! <- contenido BCD de cada imagen
+    volatile uint8_t front;                          //! <- índice de la imagen que se muestra
+    volatile uint8_t published;                      //! <- cantidad de imágenes publicadas, para WriteFrame
+    uint8_t sent;                                    //! <- valor de published en el último WriteFrame
+    uint32_t written;                                //! <- último ScreenWriteLayout, un nibble por dígito
+    uint8_t written_points;                          //! <- puntos del último ScreenWriteLayout publicado
+    bool written_valid;                              //! <- false si después se publicó otra imagen
+    screen_refresh_stats_t stats;                    //! <- tiempo encendido de cada dígito
+    uint32_t step_period;                            //! <- microsegundos entre pasos del multiplexado
 };
 
 static const uint8_t IMAGES[10] = {
@@ -69,53 +104,159 @@ static const uint8_t IMAGES[10] = {
 
 /* === Private function declarations =============================================================================== */
 
-static uint8_t DisplayFlickerDigits(ScreenT screen);
-static uint8_t DisplayFlickerPoints(ScreenT screen);
+static void ScreenRenderWords(ScreenT self, screen_frame_t * frame);
+
+/**
+ * @brief Paso del multiplexado, llamado desde la interrupción del temporizador: mide el tiempo que estuvo encendido
+ * el dígito actual y muestra el siguiente.
+ */
+
+static void ScreenRefreshStep(uint32_t ticks, void * context);
+
+/**
+ * @brief Avanza los grupos de parpadeo una imagen y recalcula las máscaras de visibilidad si alguno cambió de mitad.
+ * @return true si cambiaron las máscaras
+ */
+
+static bool ScreenBlinkStep(ScreenT self);
+
+/**
+ * @brief Refresco con un controlador externo: envía la imagen completa solo si cambió lo que hay que mostrar.
+ */
+
+static void ScreenRefreshFrame(ScreenT self);
+
+/**
+ * @brief Calcula las máscaras de visibilidad de cada dígito a partir de los grupos que están en su mitad oculta.
+ */
+
+static void ScreenBlinkMasks(ScreenT self);
+
+static uint16_t RangeMask(uint8_t from, uint8_t to);
 
 /* === Private variable definitions ================================================================================ */
 
 /* === Public variable definitions ================================================================================= */
 
+const screen_layout_t SCREEN_LAYOUT_HHMM = {.size = 4, .fields = {5, 4, 3, 2}};
+
+const screen_layout_t SCREEN_LAYOUT_MMSS = {.size = 4, .fields = {3, 2, 1, 0}};
+
+#if SCREEN_MAX_DIGITS >= 6
+const screen_layout_t SCREEN_LAYOUT_HHMMSS = {.size = 6, .fields = {5, 4, 3, 2, 1, 0}};
+#endif
+
+#if SCREEN_MAX_DIGITS >= 8
+const screen_layout_t SCREEN_LAYOUT_HH_MM_SS = {
+    .size = 8,
+    .fields = {5, 4, SCREEN_LAYOUT_BLANK, 3, 2, SCREEN_LAYOUT_BLANK, 1, 0},
+};
+#endif
+
 /* === Private function definitions ================================================================================ */
 
-static uint8_t DisplayFlickerDigits(ScreenT screen) {
-    uint8_t flick;
-    flick = screen->value[screen->current_digit]; // Obtener los segmentos del digito actual
-    if (screen->flashing_frecuency != 0) {
-        if (screen->current_digit == 0) {
+static void ScreenRenderWords(ScreenT self, screen_frame_t * frame) {
+    for (uint8_t digit = 0; digit < self->digits; digit++) {
+        frame->words[digit].segments = frame->segments[digit] & (uint8_t)~SEGMENT_P;
+        frame->words[digit].point = frame->points[digit] ? self->driver->point_word : 0;
+        frame->words[digit].digit = self->driver->digit_words[digit];
+    }
+}
 
-            screen->flashing_count = (screen->flashing_count + 1) % (screen->flashing_frecuency);
-        }
-        if (screen->flashing_count < (screen->flashing_frecuency / 2)) {
-            if (screen->current_digit >= screen->flashing_from && screen->current_digit <= screen->flashing_to) {
-                flick = 0; // Apagar los segmentos si estamos en la mitad del parpadeo
+static void ScreenRefreshStep(uint32_t ticks, void * context) {
+    ScreenT self = context;
+
+    if (self->driver->Timestamp != NULL) {
+        uint32_t now = self->driver->Timestamp();
+        if (self->stats.steps != 0) {
+            uint32_t on = now - self->stats.last;
+            uint8_t digit = self->current_digit;
+            if (on < self->stats.on_min[digit]) {
+                self->stats.on_min[digit] = on;
+            }
+            if (on > self->stats.on_max[digit]) {
+                self->stats.on_max[digit] = on;
             }
         }
+        self->stats.last = now;
     }
-    return flick;
+    self->stats.steps++;
+    // Si se perdieron períodos se muestra igual un solo dígito: repetir los pasos atrasados no sirve de nada
+    self->stats.missed += ticks - 1;
+    ScreenRefresh(self);
 }
 
-static uint8_t DisplayFlickerPoints(ScreenT screen) {
-    uint8_t flick;
-    flick = screen->value_decimal_points[screen->current_digit]; // Obtener los segmentos del digito actual
-    if (screen->decimal_points_frecuency != 0) {
-        if (screen->current_digit == 0) {
-
-            screen->decimal_points_count = (screen->decimal_points_count + 1) % (screen->decimal_points_frecuency);
+static bool ScreenBlinkStep(ScreenT self) {
+    bool changed = false;
+
+    for (uint8_t index = 0; index < SCREEN_BLINK_GROUPS; index++) {
+        screen_blink_t * group = &self->blink[index];
+        if (group->restart) {
+            group->restart = false;
+            SCREEN_BARRIER();
+            // La fase cae en la mitad oculta o en la visible; la cuenta es lo que le queda a esa mitad
+            group->hidden = group->phase < group->hidden_frames;
+            group->countdown = group->hidden ? group->hidden_frames - group->phase
+                                             : group->hidden_frames + group->visible_frames - group->phase;
+            changed = true;
+        } else if (group->hidden_frames != 0 && --group->countdown == 0) {
+            group->hidden = !group->hidden;
+            group->countdown = group->hidden ? group->hidden_frames : group->visible_frames;
+            changed = true;
         }
-        if (screen->decimal_points_count < (screen->decimal_points_frecuency / 2)) {
-            if (screen->current_digit >= screen->decimal_points_from &&
-                screen->current_digit <= screen->decimal_points_to) {
-                flick = 0; // Apagar los segmentos si estamos en la mitad del parpadeo
-            }
+    }
+    if (changed) {
+        ScreenBlinkMasks(self);
+    }
+    return changed;
+}
+
+static void ScreenRefreshFrame(ScreenT self) {
+    bool blink_changed = ScreenBlinkStep(self);
+    uint8_t published = self->published;
+    SCREEN_BARRIER();
+
+    if (!blink_changed && published == self->sent) {
+        return;
+    }
+
+    const screen_frame_t * frame = &self->frames[self->front];
+    uint8_t segments[SCREEN_MAX_DIGITS];
+    for (uint8_t digit = 0; digit < self->digits; digit++) {
+        segments[digit] = (uint8_t)((frame->segments[digit] & self->visible_segments[digit]) |
+                                    (frame->points[digit] ? (SEGMENT_P & self->visible_points[digit]) : 0));
+    }
+    self->driver->WriteFrame(segments, self->digits);
+    self->sent = published;
+}
+
+static void ScreenBlinkMasks(ScreenT self) {
+    uint16_t hidden_digits = 0;
+    uint16_t hidden_points = 0;
+
+    for (uint8_t index = 0; index < SCREEN_BLINK_GROUPS; index++) {
+        const screen_blink_t * group = &self->blink[index];
+        if (group->hidden_frames != 0 && group->hidden) {
+            hidden_digits |= group->digits;
+            hidden_points |= group->points;
         }
     }
-    return flick;
+    for (uint8_t digit = 0; digit < SCREEN_MAX_DIGITS; digit++) {
+        self->visible_segments[digit] = (hidden_digits & (1u << digit)) ? 0 : UINT32_MAX;
+        self->visible_points[digit] = (hidden_points & (1u << digit)) ? 0 : UINT32_MAX;
+    }
+}
+
+static uint16_t RangeMask(uint8_t from, uint8_t to) {
+    return (uint16_t)(((1u << (to + 1)) - 1u) & ~((1u << from) - 1u));
 }
 
 /* === Public function implementation ============================================================================== */
 
 ScreenT ScreenCreate(uint8_t digits, screen_driver_t driver) {
+    if (driver == NULL) {
+        return NULL;
+    }
     ScreenT self = malloc(sizeof(struct ScreenS));
     if (digits > SCREEN_MAX_DIGITS) {
         digits = SCREEN_MAX_DIGITS; // Limitar a la cantidad maxima de digitos
@@ -124,90 +265,236 @@ ScreenT ScreenCreate(uint8_t digits, screen_driver_t driver) {
         self->digits = digits;
         self->driver = driver;
         self->current_digit = 0; // Inicializar el digito actual
-        self->flashing_frecuency = 0;
-        self->flashing_count = 0;
-        self->decimal_points_frecuency = 0;
-        self->decimal_points_count = 0;
+        memset(self->blink, 0, sizeof(self->blink));
+        ScreenBlinkMasks(self);
+        self->published = 0;
+        self->sent = UINT8_MAX; // La primera imagen se envía aunque esté vacía
+        memset(self->frames, 0, sizeof(self->frames));
+        if (driver->WriteDigitFrame) {
+            ScreenRenderWords(self, &self->frames[0]);
+            ScreenRenderWords(self, &self->frames[1]);
+        }
+        memset(self->shadows, SCREEN_BLANK, sizeof(self->shadows));
+        for (uint8_t index = 0; index < 2; index++) {
+            self->shadows[index].points = 0;
+            self->shadows[index].size = 0;
+            self->shadows[index].valid = true;
+        }
+        self->front = 0;
+        self->written_valid = false;
+        memset(&self->stats, 0, sizeof(self->stats));
+        self->step_period = 0;
     }
     return self;
 }
 
-void ScreenWriteBCD(ScreenT self, const clock_time_t * time, bool show_seconds, uint8_t decimal_points[]) {
-    memset(self->value, 0, sizeof(self->value));
-    memset(self->value_decimal_points, 0, sizeof(self->value_decimal_points));
+void ScreenDestroy(ScreenT self) {
+    free(self);
+}
+
+screen_frame_t * ScreenBeginFrame(ScreenT self) {
+    screen_frame_t * frame = &self->frames[self->front ^ 1];
+    // Las palabras de los puertos se calculan al publicar, no hace falta limpiarlas
+    memset(frame->segments, 0, sizeof(frame->segments));
+    memset(frame->points, 0, sizeof(frame->points));
+    self->shadows[self->front ^ 1].valid = false;
+    return frame;
+}
+
+void ScreenSwapFrame(ScreenT self) {
+    if (self->driver->WriteDigitFrame) {
+        ScreenRenderWords(self, &self->frames[self->front ^ 1]);
+    }
+    SCREEN_BARRIER();
+    self->front ^= 1;
+    SCREEN_BARRIER();
+    self->published++;
+    self->written_valid = false;
+}
+
+uint8_t ScreenWriteDigits(ScreenT self, const uint8_t bcd[], uint8_t size, uint8_t points) {
+    const screen_shadow_t * shown = &self->shadows[self->front];
+    uint8_t back = self->front ^ 1;
+    uint8_t changed = 0;
+
+    if (size > self->digits) {
+        size = self->digits;
+    }
+
+    // Sin cambios respecto de lo que se muestra no se toca ninguna imagen
+    if (shown->valid && shown->points == points && shown->size == size) {
+        uint8_t digit = 0;
+        while (digit < size && shown->digits[digit] == bcd[digit]) {
+            digit++;
+        }
+        if (digit == size) {
+            return 0;
+        }
+    }
 
-    uint8_t digits[4];
+    // La imagen de trabajo tiene lo que se mostraba dos escrituras atrás: se codifica solo lo que difiere de eso
+    screen_frame_t * frame = &self->frames[back];
+    screen_shadow_t * shadow = &self->shadows[back];
+    if (!shadow->valid) {
+        memset(frame->segments, 0, sizeof(frame->segments));
+        memset(frame->points, 0, sizeof(frame->points));
+        memset(shadow->digits, SCREEN_BLANK, sizeof(shadow->digits));
+        shadow->points = 0;
+        shadow->size = 0;
+        shadow->valid = true;
+    }
 
-    if (show_seconds) {
-        // Formato MM:SS
-        digits[0] = time->time.minutes[1];  // decena de minutos
-        digits[1] = time->time.minutes[0];  // unidad de minutos
-        digits[2] = time->time.seconds[1];  // decena de segundos
-        digits[3] = time->time.seconds[0];  // unidad de segundos
-    } else {
-        // Formato HH:MM
-        digits[0] = time->time.hours[1];    // decena de horas
-        digits[1] = time->time.hours[0];    // unidad de horas
-        digits[2] = time->time.minutes[1];  // decena de minutos
-        digits[3] = time->time.minutes[0];  // unidad de minutos
+    for (uint8_t digit = 0; digit < self->digits; digit++) {
+        uint8_t value = (digit < size) ? bcd[digit] : SCREEN_BLANK;
+        if (value != shadow->digits[digit]) {
+            shadow->digits[digit] = value;
+            frame->segments[digit] = (value <= 9) ? IMAGES[value] : 0;
+            changed++;
+        }
     }
+    shadow->size = size;
 
-    for (uint8_t i = 0; i < 4; i++) {
-        if (digits[i] <= 9) {
-        self->value[i] = IMAGES[digits[i]];
-        } else {
-        self->value[i] = 0; // o algún patrón de error si querés
+    uint8_t toggled = shadow->points ^ points;
+    for (uint8_t digit = 0; toggled != 0; digit++, toggled >>= 1) {
+        if (toggled & 1) {
+            frame->points[digit] = (points & (1u << digit)) ? SEGMENT_P : 0;
+            changed++;
         }
-        self->value_decimal_points[i] = decimal_points[i] ? SEGMENT_P : 0;
     }
+    shadow->points = points;
+
+    ScreenSwapFrame(self);
+    return changed;
 }
 
+uint8_t ScreenWriteLayout(ScreenT self, const screen_layout_t * layout, const uint8_t bcd[], uint8_t points) {
+    uint8_t digits[SCREEN_MAX_DIGITS];
+    uint32_t written = UINT32_MAX;
+
+    // El diseño debe cubrir justo los dígitos de la pantalla: con otro tamaño los índices no tienen sentido
+    if (layout->size > SCREEN_MAX_DIGITS || layout->size != self->digits) {
+        return 0;
+    }
+
+    // Una sola comparación contra lo último que se escribió: el nibble n es el dígito n, 0xF si queda apagado
+    for (uint8_t digit = 0; digit < layout->size; digit++) {
+        uint8_t field = layout->fields[digit];
+        digits[digit] = (field == SCREEN_LAYOUT_BLANK) ? SCREEN_BLANK : bcd[field];
+        if (digits[digit] <= 9) {
+            written ^= (uint32_t)(0xFu ^ digits[digit]) << (4 * digit);
+        }
+    }
+    if (self->written_valid && self->written == written && self->written_points == points) {
+        return 0;
+    }
+
+    uint8_t changed = ScreenWriteDigits(self, digits, layout->size, points);
+    self->written = written;
+    self->written_points = points;
+    self->written_valid = true;
+    return changed;
+}
+
+uint8_t ScreenWriteBCD(ScreenT self, const clock_time_t * time, bool show_seconds, uint8_t decimal_points[]) {
+    uint8_t points = 0;
+
+    for (uint8_t digit = 0; digit < 4; digit++) {
+        points |= decimal_points[digit] ? (1u << digit) : 0;
+    }
+    return ScreenWriteLayout(self, show_seconds ? &SCREEN_LAYOUT_MMSS : &SCREEN_LAYOUT_HHMM, time->bcd, points);
+}
 
 void ScreenRefresh(ScreenT screen) {
-    screen->driver->DigitsTurnOff();
+    if (screen->driver->WriteFrame) {
+        ScreenRefreshFrame(screen);
+        return;
+    }
+
+    // Se lee el índice una sola vez: segmentos y punto salen de la misma imagen aunque se publique otra en el medio
+    const screen_frame_t * frame = &screen->frames[screen->front];
+    uint8_t digit = screen->current_digit + 1;
+
+    // El parpadeo avanza una vez por imagen; en cada dígito solo se aplican las máscaras ya calculadas
+    if (digit == screen->digits) {
+        digit = 0;
+        ScreenBlinkStep(screen);
+    }
+    screen->current_digit = digit;
+
+    if (screen->driver->WriteDigitFrame) {
+        screen_digit_frame_t word = frame->words[digit];
+        word.segments &= screen->visible_segments[digit];
+        word.point &= screen->visible_points[digit];
+        screen->driver->WriteDigitFrame(&word);
+        return;
+    }
 
-    screen->current_digit = (screen->current_digit + 1) % screen->digits;
+    screen->driver->DigitsTurnOff();
 
-    uint8_t segments = DisplayFlickerDigits(screen);
-    uint8_t points = DisplayFlickerPoints(screen);
+    uint8_t segments = frame->segments[digit] & (uint8_t)screen->visible_segments[digit];
+    uint8_t points = frame->points[digit] & (uint8_t)screen->visible_points[digit];
 
     // Actualizar primero los segmentos y puntos
     screen->driver->SegmentsUpdate(segments, points);
 
     // Encender el nuevo dígito inmediatamente
-    screen->driver->DigitsTurnOn(screen->current_digit);
+    screen->driver->DigitsTurnOn(digit);
 }
 
-int DisplayFlashDigits(ScreenT display, uint8_t from, uint8_t to, uint16_t divisor) {
+bool ScreenStart(ScreenT self, timebase_driver_t timer, uint16_t frame_rate) {
+    if (!self || !timer || frame_rate == 0) {
+        return false;
+    }
+    memset(&self->stats, 0, sizeof(self->stats));
+    memset(self->stats.on_min, 0xFF, sizeof(self->stats.on_min));
+    // Un controlador externo multiplexa por su cuenta: basta una llamada por imagen
+    uint8_t steps = self->driver->WriteFrame ? 1 : self->digits;
+    self->step_period = 1000000u / ((uint32_t)frame_rate * steps);
+    return timer->Start((uint32_t)frame_rate * steps, ScreenRefreshStep, self);
+}
 
-    int result = 0;
+const screen_refresh_stats_t * ScreenRefreshStats(ScreenT self) {
+    return &self->stats;
+}
+
+uint32_t ScreenOnTime(ScreenT self, uint16_t frame_rate) {
+    if (!self || frame_rate == 0 || self->digits == 0) {
+        return 0;
+    }
+    return 1000000u / ((uint32_t)frame_rate * self->digits);
+}
+
+int ScreenBlink(ScreenT self, uint8_t group, uint16_t digits, uint16_t points, uint16_t period, uint16_t phase) {
+    if (!self || group >= SCREEN_BLINK_GROUPS || (period != 0 && period < 2)) {
+        return -1;
+    }
+    screen_blink_t * blink = &self->blink[group];
+
+    // El multiplexado no avanza un grupo detenido; la nueva configuración empieza a contar en la próxima imagen
+    blink->hidden_frames = 0;
+    SCREEN_BARRIER();
+    blink->digits = digits;
+    blink->points = points;
+    blink->visible_frames = period - period / 2;
+    blink->phase = period ? phase % period : 0;
+    blink->hidden_frames = period / 2;
+    SCREEN_BARRIER();
+    blink->restart = true;
+    return 0;
+}
+
+int DisplayFlashDigits(ScreenT display, uint8_t from, uint8_t to, uint16_t divisor) {
     if ((from > to) || (from >= SCREEN_MAX_DIGITS) || (to >= SCREEN_MAX_DIGITS)) {
-        result = -1;
-    } else if (!display) {
-        result = -1;
-    } else {
-        display->flashing_from = from;
-        display->flashing_to = to;
-        display->flashing_frecuency = 2 * divisor;
-        display->flashing_count = 0;
+        return -1;
     }
-    return result;
+    return ScreenBlink(display, SCREEN_BLINK_DIGITS, RangeMask(from, to), 0, 2 * divisor, 0);
 }
 
 int DisplayFlashPoints(ScreenT display, uint8_t from, uint8_t to, uint16_t divisor) {
-
-    int result = 0;
     if ((from > to) || (from >= SCREEN_MAX_DIGITS) || (to >= SCREEN_MAX_DIGITS)) {
-        result = -1;
-    } else if (!display) {
-        result = -1;
-    } else {
-        display->decimal_points_from = from;
-        display->decimal_points_to = to;
-        display->decimal_points_frecuency = 2 * divisor;
-        display->decimal_points_count = 0;
-    }
-    return result;
+        return -1;
+    }
+    return ScreenBlink(display, SCREEN_BLINK_POINTS, 0, RangeMask(from, to), 2 * divisor, 0);
 }
 
 /* === End of documentation ======================================================================================== */
@@ -0,0 +1,74 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Roldan JesusAlejandro <kechuroldanjesus@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+/** @file task_timing.c
+ ** @brief Implementación de la instrumentación de tareas periódicas.
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "task_timing.h"
+#include <string.h>
+
+/* === Macros definitions ========================================================================================== */
+
+#define HISTOGRAM_CENTER (TASK_TIMING_BINS / 2)
+
+/* === Private data type declarations ============================================================================== */
+
+/* === Private function declarations =============================================================================== */
+
+/* === Private variable definitions ================================================================================ */
+
+/* === Public variable definitions ================================================================================= */
+
+volatile uint32_t task_timing_switches;
+
+/* === Private function definitions ================================================================================ */
+
+/* === Public function implementation ============================================================================== */
+
+void TaskTimingInit(task_timing_t * self, uint32_t now, uint32_t period) {
+    memset(self, 0, sizeof(task_timing_t));
+    self->period = period;
+    self->start = now;
+    self->last = now;
+}
+
+void TaskTimingActivation(task_timing_t * self, uint32_t now) {
+    // Las restas en aritmética sin signo siguen siendo correctas cuando el contador de ticks da la vuelta
+    int32_t jitter = (int32_t)(now - self->last - self->period);
+    int32_t bin = HISTOGRAM_CENTER + jitter;
+
+    if (bin < 0) {
+        bin = 0;
+    } else if (bin >= TASK_TIMING_BINS) {
+        bin = TASK_TIMING_BINS - 1;
+    }
+    self->histogram[bin]++;
+
+    self->activations++;
+    self->last = now;
+    self->drift = (int32_t)(now - self->start - self->activations * self->period);
+    if (self->drift > self->max_drift) {
+        self->max_drift = self->drift;
+    }
+}
+
+/* === End of documentation ======================================================================================== */
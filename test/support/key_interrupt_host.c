@@ -0,0 +1,74 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Roldan JesusAlejandro <kechuroldanjesus@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+/** @file key_interrupt_host.c
+ ** @brief Implementación de la fuente de interrupciones de teclas simulada.
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "key_interrupt_host.h"
+#include <stddef.h>
+
+/* === Macros definitions ========================================================================================== */
+
+/* === Private data type declarations ============================================================================== */
+
+/* === Private function declarations =============================================================================== */
+
+/* === Private variable definitions ================================================================================ */
+
+static key_interrupt_handler_t host_handler = NULL;
+static void * host_context = NULL;
+static bool host_levels[KEY_INTERRUPT_HOST_KEYS];
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private function definitions ================================================================================ */
+
+/* === Public function implementation ============================================================================== */
+
+void KeyInterruptHostInit(key_interrupt_handler_t handler, void * context) {
+    host_handler = handler;
+    host_context = context;
+    for (uint8_t key = 0; key < KEY_INTERRUPT_HOST_KEYS; key++) {
+        host_levels[key] = false;
+    }
+}
+
+void KeyInterruptHostSet(uint8_t key, bool active, uint32_t timestamp) {
+    if (key >= KEY_INTERRUPT_HOST_KEYS || host_levels[key] == active) {
+        return;
+    }
+    host_levels[key] = active;
+    if (host_handler != NULL) {
+        host_handler(key, active, timestamp, host_context);
+    }
+}
+
+uint32_t KeyInterruptHostBounce(uint8_t key, bool active, uint32_t timestamp, uint8_t bounces) {
+    KeyInterruptHostSet(key, active, timestamp);
+    for (uint8_t bounce = 0; bounce < bounces; bounce++) {
+        KeyInterruptHostSet(key, !active, ++timestamp);
+        KeyInterruptHostSet(key, active, ++timestamp);
+    }
+    return timestamp;
+}
+
+/* === End of documentation ======================================================================================== */
@@ -0,0 +1,90 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Roldan JesusAlejandro <kechuroldanjesus@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+#ifndef KEY_INTERRUPT_HOST_H_
+#define KEY_INTERRUPT_HOST_H_
+
+/** @file key_interrupt_host.h
+ ** @brief Fuente de interrupciones de teclas simulada para las pruebas en el host: cada cambio de nivel de una
+ * tecla llama a la función registrada, como lo hace la interrupción PININT en la placa.
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/* === Header for C++ compatibility ================================================================================ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions =================================================================================== */
+
+/** @brief Cantidad de teclas simuladas */
+#define KEY_INTERRUPT_HOST_KEYS 8
+
+/* === Public data type declarations =============================================================================== */
+
+/**
+ * @brief Función llamada en cada flanco simulado, en lugar de la rutina de interrupción
+ */
+
+typedef void (*key_interrupt_handler_t)(uint8_t key, bool active, uint32_t timestamp, void * context);
+
+/* === Public variable declarations ================================================================================ */
+
+/* === Public function declarations ================================================================================ */
+
+/**
+ * @brief Suelta todas las teclas y registra la función que atiende los flancos.
+ */
+
+void KeyInterruptHostInit(key_interrupt_handler_t handler, void * context);
+
+/**
+ * @brief Cambia el nivel de una tecla; si cambió, genera la interrupción.
+ *
+ * @param key Índice de la tecla.
+ * @param active Nuevo estado.
+ * @param timestamp Tick simulado del cambio.
+ */
+
+void KeyInterruptHostSet(uint8_t key, bool active, uint32_t timestamp);
+
+/**
+ * @brief Lleva una tecla a un estado con rebotes: alterna el nivel un tick por vez antes de quedar estable.
+ *
+ * @param key Índice de la tecla.
+ * @param active Estado final.
+ * @param timestamp Tick simulado del primer flanco.
+ * @param bounces Cantidad de rebotes (pares de flancos adicionales).
+ * @return Tick en que la tecla queda estable.
+ */
+
+uint32_t KeyInterruptHostBounce(uint8_t key, bool active, uint32_t timestamp, uint8_t bounces);
+
+/* === End of conditional blocks =================================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* KEY_INTERRUPT_HOST_H_ */
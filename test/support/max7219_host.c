@@ -0,0 +1,136 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Roldan JesusAlejandro <kechuroldanjesus@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+/** @file max7219_host.c
+ ** @brief Controladores serie tipo MAX7219 simulados para las pruebas en el host.
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "max7219_host.h"
+#include <string.h>
+
+/* === Macros definitions ========================================================================================== */
+
+/* === Private data type declarations ============================================================================== */
+
+/* === Private function declarations =============================================================================== */
+
+static void HostData(bool high);
+
+static void HostClock(bool high);
+
+static void HostLoad(bool high);
+
+/* === Private variable definitions ================================================================================ */
+
+static const struct max7219_bus_s host_bus = {
+    .Data = HostData,
+    .Clock = HostClock,
+    .Load = HostLoad,
+};
+
+static uint8_t host_chips = 0;
+static bool host_data = false;
+static bool host_clock = false;
+static bool host_load = true;
+static uint16_t host_shift[MAX7219_MAX_CHIPS];        // Registro de desplazamiento de cada controlador
+static uint8_t host_registers[MAX7219_MAX_CHIPS][16];
+static uint32_t host_bits = 0;                         // Bits desplazados desde la última carga
+static uint32_t host_loads = 0;
+static uint32_t host_errors = 0;
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private function definitions ================================================================================ */
+
+static void HostData(bool high) {
+    host_data = high;
+}
+
+static void HostClock(bool high) {
+    if (high && !host_clock) {
+        // El bit que sale de cada controlador entra en el siguiente de la cadena
+        uint16_t carry = host_data;
+        for (uint8_t chip = 0; chip < host_chips; chip++) {
+            uint16_t out = host_shift[chip] >> 15;
+            host_shift[chip] = (uint16_t)(host_shift[chip] << 1 | carry);
+            carry = out;
+        }
+        host_bits++;
+    }
+    host_clock = high;
+}
+
+static void HostLoad(bool high) {
+    if (high && !host_load) {
+        for (uint8_t chip = 0; chip < host_chips; chip++) {
+            host_registers[chip][(host_shift[chip] >> 8) & 0x0F] = host_shift[chip] & 0xFF;
+        }
+        if (host_bits != 16u * host_chips) {
+            host_errors++;
+        }
+        host_bits = 0;
+        host_loads++;
+    }
+    host_load = high;
+}
+
+/* === Public function implementation ============================================================================== */
+
+max7219_bus_t Max7219Host(uint8_t chips) {
+    host_chips = chips;
+    host_data = false;
+    host_clock = false;
+    host_load = true;
+    memset(host_shift, 0, sizeof(host_shift));
+    memset(host_registers, 0, sizeof(host_registers));
+    host_bits = 0;
+    host_loads = 0;
+    host_errors = 0;
+    return &host_bus;
+}
+
+uint8_t Max7219HostRegister(uint8_t chip, uint8_t reg) {
+    return host_registers[chip][reg & 0x0F];
+}
+
+void Max7219HostFrame(uint8_t segments[], uint8_t digits, uint8_t digits_per_chip) {
+    for (uint8_t digit = 0; digit < digits; digit++) {
+        uint8_t value = host_registers[digit / digits_per_chip][1 + digit % digits_per_chip];
+
+        // En los controladores el punto es el bit 7 y los segmentos A a G van del bit 6 al 0
+        segments[digit] = value & 0x80 ? SEGMENT_P : 0;
+        for (uint8_t segment = 0; segment < 7; segment++) {
+            if (value & (1u << (6 - segment))) {
+                segments[digit] |= 1u << segment;
+            }
+        }
+    }
+}
+
+uint32_t Max7219HostLoads(void) {
+    return host_loads;
+}
+
+uint32_t Max7219HostErrors(void) {
+    return host_errors;
+}
+
+/* === End of documentation ======================================================================================== */
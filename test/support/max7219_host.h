@@ -0,0 +1,94 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Roldan JesusAlejandro <kechuroldanjesus@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+#ifndef MAX7219_HOST_H_
+#define MAX7219_HOST_H_
+
+/** @file max7219_host.h
+ ** @brief Controladores serie tipo MAX7219 simulados para las pruebas en el host.
+ *
+ * Las líneas del bus alimentan un modelo de los registros de desplazamiento encadenados: cada flanco ascendente del
+ * reloj desplaza un bit y cada flanco ascendente de la carga copia la palabra de cada controlador en su registro.
+ * Así las pruebas reconstruyen la imagen a partir de lo que realmente viajó por el bus.
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "max7219.h"
+
+/* === Header for C++ compatibility ================================================================================ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions =================================================================================== */
+
+/* === Public data type declarations =============================================================================== */
+
+/* === Public variable declarations ================================================================================ */
+
+/* === Public function declarations ================================================================================ */
+
+/**
+ * @brief Reinicia los controladores simulados y devuelve las líneas de su bus.
+ *
+ * @param chips Cantidad de controladores encadenados
+ */
+
+max7219_bus_t Max7219Host(uint8_t chips);
+
+/**
+ * @brief Devuelve el valor de un registro de un controlador simulado.
+ *
+ * @param chip Controlador, el 0 es el más cercano al procesador
+ * @param reg Registro, de 0x00 a 0x0F
+ */
+
+uint8_t Max7219HostRegister(uint8_t chip, uint8_t reg);
+
+/**
+ * @brief Reconstruye la imagen de la pantalla, en el orden de segmentos de screen.h, a partir de los registros.
+ *
+ * @param segments Segmentos de cada dígito, con SEGMENT_P si el punto está encendido
+ * @param digits Cantidad de dígitos de la pantalla
+ * @param digits_per_chip Dígitos conectados a cada controlador
+ */
+
+void Max7219HostFrame(uint8_t segments[], uint8_t digits, uint8_t digits_per_chip);
+
+/**
+ * @brief Devuelve la cantidad de pulsos de carga recibidos.
+ */
+
+uint32_t Max7219HostLoads(void);
+
+/**
+ * @brief Devuelve la cantidad de cargas con un número de bits distinto de 16 por controlador.
+ */
+
+uint32_t Max7219HostErrors(void);
+
+/* === End of conditional blocks =================================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* MAX7219_HOST_H_ */
@@ -0,0 +1,116 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Roldan JesusAlejandro <kechuroldanjesus@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+/** @file timebase_host.c
+ ** @brief Implementación de la base de tiempo simulada para las pruebas en el host.
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "timebase_host.h"
+#include <stddef.h>
+
+/* === Macros definitions ========================================================================================== */
+
+/* === Private data type declarations ============================================================================== */
+
+/* === Private function declarations =============================================================================== */
+
+static bool HostStart(uint32_t frequency, timebase_handler_t handler, void * context);
+
+static void HostStop(void);
+
+static void HostSuspend(void);
+
+static uint32_t HostResume(void);
+
+/* === Private variable definitions ================================================================================ */
+
+static const struct timebase_driver_s host_driver = {
+    .Start = HostStart,
+    .Stop = HostStop,
+    .Suspend = HostSuspend,
+    .Resume = HostResume,
+};
+
+static timebase_handler_t host_handler = NULL;
+static void * host_context = NULL;
+static uint32_t host_frequency = 0;
+static bool host_suspended = false;
+static uint32_t host_pending = 0; // Períodos transcurridos mientras estuvo suspendida
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private function definitions ================================================================================ */
+
+static bool HostStart(uint32_t frequency, timebase_handler_t handler, void * context) {
+    if (frequency == 0 || handler == NULL) {
+        return false;
+    }
+    host_handler = handler;
+    host_context = context;
+    host_frequency = frequency;
+    host_suspended = false;
+    host_pending = 0;
+    return true;
+}
+
+static void HostStop(void) {
+    host_handler = NULL;
+    host_frequency = 0;
+}
+
+static void HostSuspend(void) {
+    host_suspended = true;
+}
+
+static uint32_t HostResume(void) {
+    uint32_t pending = host_pending;
+
+    host_suspended = false;
+    host_pending = 0;
+    // En la placa los períodos atrasados llegan en la interrupción que queda pendiente al reanudar; aquí esa
+    // interrupción simulada se atiende en el acto
+    if (pending != 0 && host_handler != NULL) {
+        host_handler(pending, host_context);
+    }
+    return pending;
+}
+
+/* === Public function implementation ============================================================================== */
+
+timebase_driver_t TimebaseHost(void) {
+    return &host_driver;
+}
+
+void TimebaseHostAdvance(uint32_t ticks) {
+    if (host_suspended) {
+        host_pending += ticks;
+        return;
+    }
+    while (ticks-- > 0 && host_handler != NULL) {
+        host_handler(1, host_context);
+    }
+}
+
+uint32_t TimebaseHostFrequency(void) {
+    return host_frequency;
+}
+
+/* === End of documentation ======================================================================================== */
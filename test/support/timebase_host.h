@@ -0,0 +1,73 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Roldan JesusAlejandro <kechuroldanjesus@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+#ifndef TIMEBASE_HOST_H_
+#define TIMEBASE_HOST_H_
+
+/** @file timebase_host.h
+ ** @brief Base de tiempo simulada para las pruebas en el host: las interrupciones se generan a pedido.
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "timebase.h"
+
+/* === Header for C++ compatibility ================================================================================ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions =================================================================================== */
+
+/* === Public data type declarations =============================================================================== */
+
+/* === Public variable declarations ================================================================================ */
+
+/* === Public function declarations ================================================================================ */
+
+/**
+ * @brief Devuelve el controlador de la base de tiempo simulada.
+ */
+
+timebase_driver_t TimebaseHost(void);
+
+/**
+ * @brief Simula el paso del tiempo generando las interrupciones indicadas, si la base de tiempo está en marcha.
+ *
+ * Si está suspendida, los períodos se acumulan y se entregan juntos al reanudarla.
+ *
+ * @param ticks Cantidad de períodos transcurridos.
+ */
+
+void TimebaseHostAdvance(uint32_t ticks);
+
+/**
+ * @brief Devuelve la frecuencia con que se inició la base de tiempo, o cero si está detenida.
+ */
+
+uint32_t TimebaseHostFrequency(void);
+
+/* === End of conditional blocks =================================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* TIMEBASE_HOST_H_ */
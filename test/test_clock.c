@@ -43,6 +43,12 @@ SPDX-License-Identifier: MIT
 
 /* === Private data type declarations ========================================================== */
 
+typedef struct {
+    uint32_t calls;     // Cantidad de llamadas recibidas
+    uint32_t minutes;   // Llamadas que incluyeron el flanco de minuto
+    uint8_t last_edges; // Flancos de la última llamada
+} edge_counter_t;
+
 /* === Private variable declarations =========================================================== */
 
 clock_t clock; // Variable para almacenar el reloj simulado
@@ -51,6 +57,8 @@ clock_t clock; // Variable para almacenar el reloj simulado
 
 static void SimulatedSeconds(clock_t clock, uint32_t seconds);
 
+static void CountEdges(clock_t clock, uint8_t edges, void * context);
+
 /* === Public variable definitions ============================================================= */
 
 /* === Private variable definitions ============================================================ */
@@ -59,10 +67,15 @@ static void SimulatedSeconds(clock_t clock, uint32_t seconds);
 
 static void SimulatedSeconds(clock_t clock, uint32_t seconds) {
     // Simula el avance del reloj en segundos
-    for (uint32_t i = 0; i <CLOCK_TICKS_PER_SECOND * seconds; i++) {
-        ClockNewTick(clock);
-    }
+    ClockAdvanceTicks(clock, CLOCK_TICKS_PER_SECOND * seconds);
+}
 
+static void CountEdges(clock_t clock, uint8_t edges, void * context) {
+    edge_counter_t * counter = context;
+    (void)clock;
+    counter->calls++;
+    counter->minutes += (edges & CLOCK_EDGE_MINUTE) ? 1 : 0;
+    counter->last_edges = edges;
 }
 
 /* === Public function implementation ========================================================= */
@@ -74,6 +87,12 @@ void setUp(void) {
 
 }
 
+void tearDown(void) {
+
+    ClockDestroy(clock);
+
+}
+
 /**
  * @brief Verifica que al crear el reloj, la hora inicial es inválida.
  */
@@ -88,6 +107,7 @@ void test_set_up_with_invalid_time (void) {
     clock_t clock = ClockCreate(CLOCK_TICKS_PER_SECOND);
     TEST_ASSERT_FALSE (ClockGetTime(clock,  &current_time));
     TEST_ASSERT_EACH_EQUAL_UINT8 (0, current_time.bcd, 6);
+    ClockDestroy(clock);
 }
 
 
@@ -323,6 +343,412 @@ void test_clock_postpone_alarm_by_minutes(void) {
     TEST_ASSERT_TIME(0, 0, 5, 3, 2, 1, result);
 }
 
+/**
+ * @brief Verifica que avanzar en bloque deja el reloj igual que avanzar tick a tick.
+ */
+
+void test_clock_advance_ticks_same_as_new_tick(void) {
+    const uint32_t ticks = CLOCK_TICKS_PER_SECOND * 3725 + 3; // 01:02:05 y tres ticks sueltos
+    clock_time_t tick_by_tick = {0};
+    clock_time_t bulk = {0};
+
+    ClockSetTime(clock, &(clock_time_t){0});
+    for (uint32_t i = 0; i < ticks; i++) {
+        ClockNewTick(clock);
+    }
+    ClockNewTick(clock);
+    ClockNewTick(clock);
+    ClockGetTime(clock, &tick_by_tick);
+
+    ClockSetTime(clock, &(clock_time_t){0});
+    ClockAdvanceTicks(clock, ticks);
+    ClockAdvanceTicks(clock, 2);
+    ClockGetTime(clock, &bulk);
+
+    TEST_ASSERT_TIME(6, 0, 2, 0, 1, 0, bulk);
+    TEST_ASSERT_EQUAL_MEMORY(&tick_by_tick, &bulk, sizeof(clock_time_t));
+}
+
+/**
+ * @brief Verifica que una coincidencia de la alarma dentro del intervalo avanzado no se pierde.
+ */
+
+void test_clock_advance_ticks_reports_alarm_inside_interval(void) {
+    ClockSetTime(clock, &(clock_time_t){0});
+    ClockSetAlarm(clock, &(clock_time_t){
+        .time = {
+            .seconds = {0, 0},
+            .minutes = {1, 0},
+            .hours   = {0, 0}
+        }
+    });
+    ClockEnableAlarm(clock);
+
+    TEST_ASSERT_TRUE(ClockAdvanceTicks(clock, CLOCK_TICKS_PER_SECOND * 120)); // 00:00 → 00:02
+    TEST_ASSERT_FALSE(ClockAlarmMatchTheTime(clock));
+    TEST_ASSERT_FALSE(ClockAdvanceTicks(clock, CLOCK_TICKS_PER_SECOND * 60));
+}
+
+/**
+ * @brief Verifica que la alarma cancelada por hoy se rearma al cruzar la medianoche en un avance en bloque.
+ */
+
+void test_clock_advance_ticks_rearms_alarm_after_midnight(void) {
+    ClockSetTime(clock, &(clock_time_t){
+        .time = {
+            .seconds = {0, 0},
+            .minutes = {0, 0},
+            .hours   = {3, 2}   // 23:00:00
+        }
+    });
+    ClockSetAlarm(clock, &(clock_time_t){
+        .time = {
+            .seconds = {0, 0},
+            .minutes = {0, 0},
+            .hours   = {6, 0}   // 06:00
+        }
+    });
+    ClockEnableAlarm(clock);
+    ClockCancelAlarmToday(clock);
+
+    TEST_ASSERT_FALSE(ClockAdvanceTicks(clock, CLOCK_TICKS_PER_SECOND * 3600)); // 00:00, sin alarma
+    TEST_ASSERT_TRUE(ClockIsAlarmEnabled(clock));
+    TEST_ASSERT_TRUE(ClockAdvanceTicks(clock, CLOCK_TICKS_PER_SECOND * 7 * 3600)); // 07:00, pasó por 06:00
+}
+/**
+ * @brief Verifica que dos relojes del pool son independientes y avanzan juntos desde una misma base de tiempo.
+ */
+
+void test_clock_instances_are_independent(void) {
+    clock_t second_clock = ClockCreate(2 * CLOCK_TICKS_PER_SECOND);
+    clock_time_t current_time = {0};
+
+    TEST_ASSERT_NOT_NULL(second_clock);
+    TEST_ASSERT_TRUE(second_clock != clock);
+
+    ClockSetTime(clock, &(clock_time_t){0});
+    ClockSetTime(second_clock, &(clock_time_t){
+        .time = {
+            .seconds = {0, 0},
+            .minutes = {0, 0},
+            .hours   = {2, 1}   // 12:00:00
+        }
+    });
+
+    for (uint32_t i = 0; i < 2 * CLOCK_TICKS_PER_SECOND; i++) {
+        ClockNewTickAll();
+    }
+
+    ClockGetTime(clock, &current_time);
+    TEST_ASSERT_TIME(2, 0, 0, 0, 0, 0, current_time);
+    ClockGetTime(second_clock, &current_time);
+    TEST_ASSERT_TIME(1, 0, 0, 0, 2, 1, current_time);
+
+    ClockAdvanceTicksAll(CLOCK_TICKS_PER_SECOND * 120);
+    ClockGetTime(clock, &current_time);
+    TEST_ASSERT_TIME(2, 0, 2, 0, 0, 0, current_time);
+    ClockGetTime(second_clock, &current_time);
+    TEST_ASSERT_TIME(1, 0, 1, 0, 2, 1, current_time);
+
+    ClockDestroy(second_clock);
+}
+
+/**
+ * @brief Verifica que al agotar el pool se obtiene NULL y que destruir un reloj libera su lugar.
+ */
+
+void test_clock_pool_exhausted_returns_null(void) {
+    clock_t created[16] = {0};
+    uint8_t count = 0;
+
+    while (count < 16 && (created[count] = ClockCreate(CLOCK_TICKS_PER_SECOND)) != NULL) {
+        count++;
+    }
+    TEST_ASSERT_EQUAL_UINT8(CLOCK_MAX_INSTANCES - 1, count); // setUp ya tomó uno
+    TEST_ASSERT_NULL(ClockCreate(CLOCK_TICKS_PER_SECOND));
+
+    ClockDestroy(created[0]);
+    created[0] = ClockCreate(CLOCK_TICKS_PER_SECOND);
+    TEST_ASSERT_NOT_NULL(created[0]);
+
+    for (uint8_t i = 0; i < count; i++) {
+        ClockDestroy(created[i]);
+    }
+}
+/**
+ * @brief Verifica la conversión entre la hora BCD de 6 bytes y la palabra empaquetada.
+ */
+
+void test_clock_packed_time_round_trip(void) {
+    clock_time_t time = {
+        .time = {
+            .seconds = {7, 5},
+            .minutes = {4, 3},
+            .hours   = {2, 1}
+        }
+    };
+    clock_time_t result = {0};
+
+    TEST_ASSERT_EQUAL_HEX32(0x00123457, ClockTimePack(&time));
+    ClockTimeUnpack(0x00123457, &result);
+    TEST_ASSERT_TIME(7, 5, 4, 3, 2, 1, result);
+}
+
+/**
+ * @brief Verifica que el incremento empaquetado recorre un día completo igual que el reloj.
+ */
+
+void test_clock_packed_increment_follows_clock_for_a_day(void) {
+    clock_packed_t packed = 0;
+    clock_time_t current_time = {0};
+
+    ClockSetTime(clock, &(clock_time_t){0});
+    for (uint32_t second = 0; second < 86400; second++) {
+        packed = ClockPackedIncrement(packed);
+        SimulatedSeconds(clock, 1);
+        ClockGetTime(clock, &current_time);
+        TEST_ASSERT_EQUAL_HEX32(ClockTimePack(&current_time), packed);
+    }
+    TEST_ASSERT_EQUAL_HEX32(0, packed);
+}
+
+/**
+ * @brief Verifica la comparación enmascarada de horas empaquetadas.
+ */
+
+void test_clock_packed_match_ignores_masked_digits(void) {
+    TEST_ASSERT_TRUE(ClockPackedMatch(0x00123459, 0x00123400, CLOCK_PACKED_MASK_HHMM));
+    TEST_ASSERT_FALSE(ClockPackedMatch(0x00123459, 0x00123400, CLOCK_PACKED_MASK_ALL));
+    TEST_ASSERT_FALSE(ClockPackedMatch(0x00123559, 0x00123459, CLOCK_PACKED_MASK_HHMM));
+}
+/**
+ * @brief Verifica que ClockNewTick avisa una sola vez, en el tick exacto en que suena la alarma.
+ */
+
+void test_clock_new_tick_signals_alarm_once(void) {
+    uint32_t fired = 0;
+    uint32_t fired_at = 0;
+
+    ClockSetTime(clock, &(clock_time_t){
+        .time = {
+            .seconds = {8, 5},
+            .minutes = {0, 0},
+            .hours   = {0, 0}   // 00:00:58
+        }
+    });
+    ClockSetAlarm(clock, &(clock_time_t){
+        .time = {
+            .seconds = {0, 0},
+            .minutes = {1, 0},
+            .hours   = {0, 0}
+        }
+    });
+    ClockEnableAlarm(clock);
+
+    for (uint32_t tick = 1; tick <= CLOCK_TICKS_PER_SECOND * 120; tick++) {
+        if (ClockNewTick(clock)) {
+            fired++;
+            fired_at = tick;
+        }
+    }
+
+    TEST_ASSERT_EQUAL(1, fired);
+    TEST_ASSERT_EQUAL(2 * CLOCK_TICKS_PER_SECOND, fired_at);
+}
+
+/**
+ * @brief Verifica la cuenta regresiva hasta la alarma y su recálculo al posponer.
+ */
+
+void test_clock_time_until_alarm(void) {
+    uint32_t seconds = 0;
+
+    ClockSetTime(clock, &(clock_time_t){
+        .time = {
+            .seconds = {0, 3},
+            .minutes = {9, 5},
+            .hours   = {6, 0}   // 06:59:30
+        }
+    });
+    ClockSetAlarm(clock, &(clock_time_t){
+        .time = {
+            .seconds = {0, 0},
+            .minutes = {0, 0},
+            .hours   = {7, 0}   // 07:00
+        }
+    });
+
+    TEST_ASSERT_FALSE(ClockTimeUntilAlarm(clock, &seconds));
+
+    ClockEnableAlarm(clock);
+    TEST_ASSERT_TRUE(ClockTimeUntilAlarm(clock, &seconds));
+    TEST_ASSERT_EQUAL_UINT32(30, seconds);
+
+    SimulatedSeconds(clock, 10);
+    ClockTimeUntilAlarm(clock, &seconds);
+    TEST_ASSERT_EQUAL_UINT32(20, seconds);
+
+    ClockPostponeAlarm(clock, 5);
+    ClockTimeUntilAlarm(clock, &seconds);
+    TEST_ASSERT_EQUAL_UINT32(320, seconds);
+}
+/**
+ * @brief Verifica que varias alarmas de la tabla disparan cada una en su minuto.
+ */
+
+void test_clock_multiple_alarms_fire_in_order(void) {
+    uint32_t fired_at[3] = {0};
+    uint8_t fired = 0;
+
+    ClockSetTime(clock, &(clock_time_t){0});
+    ClockSetAlarmById(clock, 1, &(clock_time_t){ .time = { .minutes = {3, 0} } });  // 00:03
+    ClockSetAlarmById(clock, 2, &(clock_time_t){ .time = { .minutes = {1, 0} } });  // 00:01
+    ClockSetAlarmById(clock, 3, &(clock_time_t){ .time = { .minutes = {2, 0} } });  // 00:02, deshabilitada
+    ClockEnableAlarmById(clock, 1);
+    ClockEnableAlarmById(clock, 2);
+
+    for (uint32_t second = 1; second <= 300; second++) {
+        for (uint8_t tick = 0; tick < CLOCK_TICKS_PER_SECOND; tick++) {
+            if (ClockNewTick(clock) && fired < 3) {
+                fired_at[fired++] = second;
+            }
+        }
+    }
+
+    TEST_ASSERT_EQUAL(2, fired);
+    TEST_ASSERT_EQUAL(60, fired_at[0]);
+    TEST_ASSERT_EQUAL(180, fired_at[1]);
+    TEST_ASSERT_FALSE(ClockIsAlarmEnabled(clock));
+    TEST_ASSERT_FALSE(ClockSetAlarmById(clock, CLOCK_MAX_ALARMS, &(clock_time_t){0}));
+}
+
+/**
+ * @brief Verifica que al cancelar por hoy una alarma pospuesta, vuelve a la hora en que estaba programada.
+ */
+
+void test_clock_cancel_postponed_alarm_restores_programmed_time(void) {
+    clock_time_t result = {0};
+
+    ClockSetAlarmById(clock, 1, &(clock_time_t){ .time = { .hours = {7, 0} } });  // 07:00
+    ClockEnableAlarmById(clock, 1);
+    ClockPostponeAlarmById(clock, 1, 5);
+    ClockGetAlarmById(clock, 1, &result);
+    TEST_ASSERT_TIME(0, 0, 5, 0, 7, 0, result);
+
+    ClockCancelAlarmTodayById(clock, 1);
+    ClockGetAlarmById(clock, 1, &result);
+    TEST_ASSERT_TIME(0, 0, 0, 0, 7, 0, result);
+    TEST_ASSERT_FALSE(ClockIsAlarmEnabledById(clock, 1));
+}
+
+/**
+ * @brief Verifica que los observadores se llaman solo en los flancos que registraron.
+ */
+
+void test_clock_observer_notified_on_selected_edges(void) {
+    edge_counter_t seconds = {0};
+    edge_counter_t minutes = {0};
+
+    ClockSetTime(clock, &(clock_time_t){ .time = { .seconds = {0, 5}, .minutes = {9, 5}, .hours = {3, 2} } });
+    TEST_ASSERT_TRUE(ClockAddObserver(clock, CLOCK_EDGE_SECOND, CountEdges, &seconds));
+    TEST_ASSERT_TRUE(ClockAddObserver(clock, CLOCK_EDGE_MINUTE, CountEdges, &minutes));
+
+    for (uint32_t tick = 0; tick < 15 * CLOCK_TICKS_PER_SECOND; tick++) {
+        ClockNewTick(clock);
+    }
+
+    TEST_ASSERT_EQUAL(15, seconds.calls);
+    TEST_ASSERT_EQUAL(1, minutes.calls);
+    TEST_ASSERT_EQUAL_HEX8(CLOCK_EDGE_SECOND | CLOCK_EDGE_MINUTE | CLOCK_EDGE_HOUR | CLOCK_EDGE_DAY,
+                           minutes.last_edges);
+
+    ClockRemoveObserver(clock, CountEdges, &seconds);
+    SimulatedSeconds(clock, 1);
+    TEST_ASSERT_EQUAL(15, seconds.calls);
+}
+
+/**
+ * @brief Verifica que un avance en bloque informa una sola vez todos los flancos cruzados.
+ */
+
+void test_clock_observer_advance_ticks_reports_crossed_edges(void) {
+    edge_counter_t counter = {0};
+
+    ClockSetTime(clock, &(clock_time_t){ .time = { .minutes = {8, 5} } });  // 00:58:00
+    ClockAddObserver(clock, CLOCK_EDGE_HOUR, CountEdges, &counter);
+
+    SimulatedSeconds(clock, 60);
+    TEST_ASSERT_EQUAL(0, counter.calls);
+
+    SimulatedSeconds(clock, 90);
+    TEST_ASSERT_EQUAL(1, counter.calls);
+    TEST_ASSERT_EQUAL_HEX8(CLOCK_EDGE_SECOND | CLOCK_EDGE_MINUTE | CLOCK_EDGE_HOUR, counter.last_edges);
+
+    for (uint8_t index = 1; index < CLOCK_MAX_OBSERVERS; index++) {
+        TEST_ASSERT_TRUE(ClockAddObserver(clock, CLOCK_EDGE_DAY, CountEdges, &counter));
+    }
+    TEST_ASSERT_FALSE(ClockAddObserver(clock, CLOCK_EDGE_DAY, CountEdges, &counter));
+}
+
+/**
+ * @brief Verifica que la hora publicada para los lectores sigue a los segundos durante todo un día, incluidos los
+ * acarreos y un avance en bloque.
+ */
+
+void test_clock_get_time_snapshot_follows_every_second(void) {
+    clock_time_t result = {0};
+
+    ClockSetTime(clock, &(clock_time_t){0});
+    for (uint32_t second = 1; second <= 86400; second++) {
+        for (uint8_t tick = 0; tick < CLOCK_TICKS_PER_SECOND; tick++) {
+            ClockNewTick(clock);
+        }
+        uint32_t now = second % 86400;
+        TEST_ASSERT_TRUE(ClockGetTime(clock, &result));
+        TEST_ASSERT_TIME(now % 10, now / 10 % 6, now / 60 % 10, now / 600 % 6, now / 3600 % 10, now / 36000, result);
+    }
+
+    SimulatedSeconds(clock, 3599);
+    ClockGetTime(clock, &result);
+    TEST_ASSERT_TIME(9, 5, 9, 5, 0, 0, result);
+}
+
+/**
+ * @brief Verifica que sumar un desplazamiento a un campo BCD da lo mismo que aplicar uno por uno los pasos, con la
+ * vuelta en ambos sentidos.
+ */
+
+void test_clock_bcd_adjust_matches_single_steps(void) {
+    for (int16_t delta = -130; delta <= 130; delta++) {
+        for (uint8_t start = 0; start < 60; start++) {
+            uint8_t minutes[2] = {start % 10, start / 10};
+            uint8_t expected = (uint8_t)(((start + delta) % 60 + 60) % 60);
+
+            ClockBcdAdjust(minutes, delta, 60);
+            TEST_ASSERT_EQUAL(expected % 10, minutes[0]);
+            TEST_ASSERT_EQUAL(expected / 10, minutes[1]);
+        }
+    }
+}
+
+/**
+ * @brief Verifica la vuelta de las horas en los extremos del desplazamiento.
+ */
+
+void test_clock_bcd_adjust_hours_wraparound(void) {
+    uint8_t hours[2] = {3, 2};
+
+    ClockBcdAdjust(hours, 1, 24);
+    TEST_ASSERT_EQUAL(0, hours[0]);
+    TEST_ASSERT_EQUAL(0, hours[1]);
+
+    ClockBcdAdjust(hours, -1, 24);
+    TEST_ASSERT_EQUAL(3, hours[0]);
+    TEST_ASSERT_EQUAL(2, hours[1]);
+
+    ClockBcdAdjust(hours, INT16_MIN, 24);
+    TEST_ASSERT_EQUAL(((23 + INT16_MIN % 24) + 24) % 24 % 10, hours[0]);
+}
 
 /* === End of documentation ==================================================================== */
 
@@ -0,0 +1,204 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Roldan JesusAlejandro <kechuroldanjesus@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+/** @file test_debounce.c
+ ** @brief Pruebas unitarias del antirrebote en paralelo, alimentado con trazas de teclas con ruido:
+ * - Pulsaciones limpias y con rebotes.
+ * - Pulsos cortos que se descartan.
+ * - Varias teclas que cambian en la misma muestra.
+ **/
+
+/* === Headers files inclusions =============================================================== */
+
+#include "unity.h"
+#include "debounce.h"
+#include <stdbool.h>
+#include <string.h>
+
+/* === Macros definitions ====================================================================== */
+
+#define MAX_EVENTS 16
+
+/* === Private data type declarations ========================================================== */
+
+/**
+ * @brief Flanco filtrado informado por el antirrebote
+ */
+
+typedef struct {
+    uint16_t sample; //!< Número de muestra en que se informó
+    uint8_t key;     //!< Tecla
+    bool pressed;    //!< true si se activó, false si se liberó
+} trace_event_t;
+
+/* === Private variable declarations =========================================================== */
+
+static debounce_t debounce;
+static trace_event_t events[MAX_EVENTS];
+static uint16_t event_count;
+
+/* === Private function declarations =========================================================== */
+
+static void RunTraces(const char * const traces[], uint8_t keys);
+
+/* === Public variable definitions ============================================================= */
+
+/* === Private variable definitions ============================================================ */
+
+/* === Private function implementation ========================================================= */
+
+/**
+ * @brief Procesa en paralelo las trazas de varias teclas y guarda los flancos informados.
+ *
+ * Cada traza es una cadena de '0' y '1', una muestra por carácter; todas deben tener el mismo largo.
+ */
+
+static void RunTraces(const char * const traces[], uint8_t keys) {
+    size_t length = strlen(traces[0]);
+
+    for (uint16_t sample = 0; sample < length; sample++) {
+        uint32_t bits = 0;
+        for (uint8_t key = 0; key < keys; key++) {
+            if (traces[key][sample] == '1') {
+                bits |= 1u << key;
+            }
+        }
+
+        debounce_edges_t edges = DebounceUpdate(&debounce, bits);
+        for (uint8_t key = 0; key < keys; key++) {
+            uint32_t mask = 1u << key;
+            if (((edges.pressed | edges.released) & mask) && event_count < MAX_EVENTS) {
+                events[event_count].sample = sample;
+                events[event_count].key = key;
+                events[event_count].pressed = (edges.pressed & mask) != 0;
+                event_count++;
+            }
+        }
+    }
+}
+
+/* === Public function implementation ========================================================= */
+
+void setUp(void) {
+    DebounceInit(&debounce, 0);
+    event_count = 0;
+}
+
+/**
+ * @brief Verifica que una pulsación limpia se acepta en la cuarta muestra.
+ */
+
+void test_debounce_clean_press(void) {
+    const char * const traces[] = {"0011111"};
+
+    RunTraces(traces, 1);
+
+    TEST_ASSERT_EQUAL(1, event_count);
+    TEST_ASSERT_TRUE(events[0].pressed);
+    TEST_ASSERT_EQUAL(2 + DEBOUNCE_SAMPLES - 1, events[0].sample);
+    TEST_ASSERT_EQUAL(1, debounce.state);
+}
+
+/**
+ * @brief Verifica que una pulsación con rebotes genera un solo flanco, cuando la tecla queda estable.
+ */
+
+void test_debounce_bouncing_press_reports_one_edge(void) {
+    const char * const traces[] = {"0101101110111111"};
+
+    RunTraces(traces, 1);
+
+    TEST_ASSERT_EQUAL(1, event_count);
+    TEST_ASSERT_TRUE(events[0].pressed);
+    TEST_ASSERT_EQUAL(13, events[0].sample);
+}
+
+/**
+ * @brief Verifica que los pulsos más cortos que el antirrebote se descartan.
+ */
+
+void test_debounce_short_glitches_are_ignored(void) {
+    const char * const traces[] = {"00111000100110000000"};
+
+    RunTraces(traces, 1);
+
+    TEST_ASSERT_EQUAL(0, event_count);
+    TEST_ASSERT_EQUAL(0, debounce.state);
+}
+
+/**
+ * @brief Verifica que una pulsación completa con ruido en ambos flancos da exactamente una activación y una
+ * liberación.
+ */
+
+void test_debounce_noisy_press_and_release(void) {
+    const char * const traces[] = {"0010110111111110111100101000000"};
+
+    RunTraces(traces, 1);
+
+    TEST_ASSERT_EQUAL(2, event_count);
+    TEST_ASSERT_TRUE(events[0].pressed);
+    TEST_ASSERT_FALSE(events[1].pressed);
+    TEST_ASSERT_EQUAL(28, events[1].sample);
+}
+
+/**
+ * @brief Verifica que varias teclas que cambian juntas se informan en la misma muestra, sin que una tape a otra.
+ */
+
+void test_debounce_keys_change_in_same_sample(void) {
+    const char * const traces[] = {
+        "0111100001",
+        "0111100000",
+        "0011011111",
+    };
+
+    RunTraces(traces, 3);
+
+    TEST_ASSERT_EQUAL(5, event_count);
+    TEST_ASSERT_EQUAL(4, events[0].sample);
+    TEST_ASSERT_EQUAL(0, events[0].key);
+    TEST_ASSERT_EQUAL(4, events[1].sample);
+    TEST_ASSERT_EQUAL(1, events[1].key);
+
+    TEST_ASSERT_EQUAL(8, events[2].sample);
+    TEST_ASSERT_FALSE(events[2].pressed);
+    TEST_ASSERT_EQUAL(8, events[3].sample);
+    TEST_ASSERT_FALSE(events[3].pressed);
+    TEST_ASSERT_EQUAL(2, events[4].key);
+    TEST_ASSERT_TRUE(events[4].pressed);
+}
+
+/**
+ * @brief Verifica que se informa si quedan teclas con cambios todavía sin aceptar.
+ */
+
+void test_debounce_pending_until_stable(void) {
+    DebounceUpdate(&debounce, 0x04);
+    TEST_ASSERT_EQUAL(0x04, DebouncePending(&debounce, 0x04));
+
+    for (int sample = 1; sample < DEBOUNCE_SAMPLES; sample++) {
+        DebounceUpdate(&debounce, 0x04);
+    }
+    TEST_ASSERT_EQUAL(0, DebouncePending(&debounce, 0x04));
+}
+
+/* === End of documentation ==================================================================== */
+
+/** @} End of module definition for doxygen */
@@ -0,0 +1,255 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Roldan JesusAlejandro <kechuroldanjesus@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+/** @file test_fsm.c
+ ** @brief Pruebas unitarias de la máquina de estados de la interfaz del reloj:
+ * - Acciones de entrada de cada estado sobre la pantalla.
+ * - Puesta en hora y configuración de la alarma con las teclas.
+ * - Alarma sonando, postergación y cancelación.
+ * - Eventos que no corresponden al estado actual.
+ **/
+
+/* === Headers files inclusions =============================================================== */
+
+#include "unity.h"
+#include "fsm.h"
+
+/* === Macros definitions ====================================================================== */
+
+#define TEST_TICKS_PER_SECOND 5
+
+/* === Private data type declarations ========================================================== */
+
+typedef struct {
+    uint8_t from;
+    uint8_t to;
+    uint16_t divisor;
+} flash_call_t;
+
+/* === Private variable declarations =========================================================== */
+
+static clock_t clock;
+static fsm_t fsm;
+static flash_call_t last_digits;
+static flash_call_t last_points;
+static uint32_t flash_calls;
+static bool alarm_output;
+
+/* === Private function declarations =========================================================== */
+
+static void MockFlashDigits(uint8_t from, uint8_t to, uint16_t divisor);
+
+static void MockFlashPoints(uint8_t from, uint8_t to, uint16_t divisor);
+
+static void MockAlarmOutput(bool on);
+
+static clock_state_t Send(event_t type, int16_t delta);
+
+/* === Public variable definitions ============================================================= */
+
+/* === Private variable definitions ============================================================ */
+
+static const struct fsm_driver_s mock_driver = {
+    .FlashDigits = MockFlashDigits,
+    .FlashPoints = MockFlashPoints,
+    .AlarmOutput = MockAlarmOutput,
+};
+
+/* === Private function implementation ========================================================= */
+
+static void MockFlashDigits(uint8_t from, uint8_t to, uint16_t divisor) {
+    last_digits = (flash_call_t){from, to, divisor};
+    flash_calls++;
+}
+
+static void MockFlashPoints(uint8_t from, uint8_t to, uint16_t divisor) {
+    last_points = (flash_call_t){from, to, divisor};
+}
+
+static void MockAlarmOutput(bool on) {
+    alarm_output = on;
+}
+
+static clock_state_t Send(event_t type, int16_t delta) {
+    app_event_t event = {.type = type, .delta = delta, .long_press = false};
+    return FsmDispatch(&fsm, &event);
+}
+
+/* === Public function implementation ========================================================= */
+
+void setUp(void) {
+    clock = ClockCreate(TEST_TICKS_PER_SECOND);
+    flash_calls = 0;
+    alarm_output = false;
+    FsmInit(&fsm, clock, &mock_driver);
+}
+
+void tearDown(void) {
+    ClockDestroy(clock);
+}
+
+// Al iniciar la máquina parpadean todos los dígitos y el punto central
+void test_init_flashes_whole_display(void) {
+    TEST_ASSERT_EQUAL(STATE_CLOCK_INIT, fsm.state);
+    TEST_ASSERT_EQUAL_UINT8(0, last_digits.from);
+    TEST_ASSERT_EQUAL_UINT8(3, last_digits.to);
+    TEST_ASSERT_EQUAL_UINT16(100, last_digits.divisor);
+    TEST_ASSERT_EQUAL_UINT8(1, last_points.from);
+    TEST_ASSERT_EQUAL_UINT8(1, last_points.to);
+    TEST_ASSERT_FALSE(FsmIsEditing(&fsm));
+}
+
+// Poner en hora: minutos, aceptar, horas, aceptar; el reloj queda con la hora ajustada y los segundos en cero
+void test_set_time_flow_updates_clock(void) {
+    clock_time_t now = {0};
+
+    TEST_ASSERT_EQUAL(STATE_SET_MINUTES, Send(EV_SET_TIME, 0));
+    TEST_ASSERT_EQUAL_UINT8(2, last_digits.from);
+    TEST_ASSERT_EQUAL_UINT16(50, last_digits.divisor);
+    TEST_ASSERT_TRUE(FsmIsEditing(&fsm));
+
+    Send(EV_ADJUST, 35);
+    Send(EV_ADJUST, -5);
+    TEST_ASSERT_EQUAL(STATE_SET_HOURS, Send(EV_ACCEPT, 0));
+    TEST_ASSERT_EQUAL_UINT8(0, last_digits.from);
+    TEST_ASSERT_EQUAL_UINT8(1, last_digits.to);
+
+    Send(EV_ADJUST, -1);
+    TEST_ASSERT_EQUAL(STATE_NORMAL, Send(EV_ACCEPT, 0));
+    TEST_ASSERT_EQUAL_UINT16(0, last_digits.divisor);
+
+    TEST_ASSERT_TRUE(ClockGetTime(clock, &now));
+    TEST_ASSERT_EQUAL_UINT8(0, now.time.seconds[0]);
+    TEST_ASSERT_EQUAL_UINT8(0, now.time.minutes[0]);
+    TEST_ASSERT_EQUAL_UINT8(3, now.time.minutes[1]);
+    TEST_ASSERT_EQUAL_UINT8(3, now.time.hours[0]);
+    TEST_ASSERT_EQUAL_UINT8(2, now.time.hours[1]);
+}
+
+// Cancelar la primera puesta en hora vuelve a la espera inicial; con la hora válida vuelve al estado normal
+void test_cancel_set_time_returns_to_init_or_normal(void) {
+    Send(EV_SET_TIME, 0);
+    TEST_ASSERT_EQUAL(STATE_CLOCK_INIT, Send(EV_CANCEL, 0));
+
+    Send(EV_SET_TIME, 0);
+    Send(EV_ACCEPT, 0);
+    Send(EV_ACCEPT, 0);
+    Send(EV_SET_TIME, 0);
+    Send(EV_ACCEPT, 0);
+    TEST_ASSERT_EQUAL(STATE_NORMAL, Send(EV_CANCEL, 0));
+}
+
+// Limpiar pone en cero solo el campo que se está editando
+void test_clear_zeroes_current_field(void) {
+    Send(EV_SET_TIME, 0);
+    Send(EV_ADJUST, 12);
+    Send(EV_ACCEPT, 0);
+    Send(EV_ADJUST, 7);
+    Send(EV_CLEAR, 0);
+
+    TEST_ASSERT_EQUAL_UINT8(0, fsm.time_clock.time.hours[0]);
+    TEST_ASSERT_EQUAL_UINT8(0, fsm.time_clock.time.hours[1]);
+    TEST_ASSERT_EQUAL_UINT8(2, fsm.time_clock.time.minutes[0]);
+    TEST_ASSERT_EQUAL_UINT8(1, fsm.time_clock.time.minutes[1]);
+}
+
+// La alarma configurada suena al coincidir con la hora y aceptar la posterga
+void test_alarm_rings_and_snoozes(void) {
+    Send(EV_SET_TIME, 0);
+    Send(EV_ACCEPT, 0);
+    Send(EV_ADJUST, 7);
+    Send(EV_ACCEPT, 0);
+
+    Send(EV_SET_ALARM, 0);
+    Send(EV_ADJUST, 1);
+    Send(EV_ACCEPT, 0);
+    Send(EV_ADJUST, 7);
+    TEST_ASSERT_EQUAL(STATE_NORMAL, Send(EV_ACCEPT, 0));
+    TEST_ASSERT_TRUE(fsm.alarm_enabled);
+
+    Send(EV_ALARM, 0);
+    TEST_ASSERT_FALSE(alarm_output);
+
+    ClockAdvanceTicks(clock, 60 * TEST_TICKS_PER_SECOND);
+    Send(EV_ALARM, 0);
+    TEST_ASSERT_TRUE(alarm_output);
+    TEST_ASSERT_TRUE(fsm.alarm_triggered);
+
+    Send(EV_ACCEPT, 0);
+    TEST_ASSERT_FALSE(alarm_output);
+    TEST_ASSERT_FALSE(fsm.alarm_triggered);
+    TEST_ASSERT_TRUE(fsm.alarm_enabled);
+}
+
+// Una alarma que llega durante una edición suena al volver al estado normal, sin volver a consultar al reloj
+void test_alarm_during_edit_rings_on_return(void) {
+    Send(EV_SET_TIME, 0);
+    Send(EV_ACCEPT, 0);
+    Send(EV_ACCEPT, 0);
+    Send(EV_ACCEPT, 0); // En el estado normal, aceptar habilita la alarma
+    TEST_ASSERT_TRUE(fsm.alarm_enabled);
+
+    Send(EV_SET_ALARM, 0);
+    Send(EV_ALARM, 0);
+    TEST_ASSERT_FALSE(alarm_output);
+
+    ClockAdvanceTicks(clock, 5 * 60 * TEST_TICKS_PER_SECOND);
+    TEST_ASSERT_EQUAL(STATE_NORMAL, Send(EV_CANCEL, 0));
+    TEST_ASSERT_TRUE(alarm_output);
+    TEST_ASSERT_FALSE(fsm.alarm_pending);
+}
+
+// Cancelar en el estado normal sin alarma sonando la deshabilita, aceptar la vuelve a habilitar
+void test_cancel_and_accept_toggle_alarm(void) {
+    Send(EV_SET_TIME, 0);
+    Send(EV_ACCEPT, 0);
+    Send(EV_ACCEPT, 0);
+
+    Send(EV_CANCEL, 0);
+    TEST_ASSERT_FALSE(fsm.alarm_enabled);
+    TEST_ASSERT_FALSE(ClockIsAlarmEnabled(clock));
+
+    Send(EV_ACCEPT, 0);
+    TEST_ASSERT_TRUE(fsm.alarm_enabled);
+    TEST_ASSERT_TRUE(ClockIsAlarmEnabled(clock));
+}
+
+// Los eventos que no corresponden al estado no cambian nada ni tocan la pantalla
+void test_ignored_events_have_no_effect(void) {
+    uint32_t calls = flash_calls;
+
+    TEST_ASSERT_EQUAL(STATE_CLOCK_INIT, Send(EV_SET_ALARM, 0));
+    TEST_ASSERT_EQUAL(STATE_CLOCK_INIT, Send(EV_ADJUST, 3));
+    TEST_ASSERT_EQUAL(STATE_CLOCK_INIT, Send(EV_ALARM, 0));
+    TEST_ASSERT_EQUAL(STATE_CLOCK_INIT, Send(EV_COUNT, 0));
+    TEST_ASSERT_EQUAL_UINT32(calls, flash_calls);
+    TEST_ASSERT_FALSE(alarm_output);
+}
+
+// Toda combinación de estado y evento tiene una acción y deja la máquina en un estado válido
+void test_every_state_event_pair_is_handled(void) {
+    for (int state = 0; state < STATE_COUNT; state++) {
+        for (int type = 0; type < EV_COUNT; type++) {
+            fsm.state = (clock_state_t)state;
+            TEST_ASSERT_TRUE(Send((event_t)type, 1) < STATE_COUNT);
+        }
+    }
+}
+
+/* === End of documentation ==================================================================== */
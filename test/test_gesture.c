@@ -0,0 +1,189 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Roldan JesusAlejandro <kechuroldanjesus@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+/** @file test_gesture.c
+ ** @brief Pruebas unitarias del detector de gestos de las teclas:
+ * - Pulsación simple y pulsación larga.
+ * - Repetición automática con aceleración y repeticiones atrasadas agrupadas en un evento.
+ * - Acordes y toques cortos de las teclas que forman parte de un acorde.
+ * - Momento del próximo evento programado.
+ **/
+
+/* === Headers files inclusions =============================================================== */
+
+#include "unity.h"
+#include "gesture.h"
+
+/* === Macros definitions ====================================================================== */
+
+#define KEY_PLAIN     0
+#define KEY_LONG      1
+#define KEY_UP        2
+#define KEY_DOWN      3
+
+#define BIT(key)      (1u << (key))
+
+/* === Private data type declarations ========================================================== */
+
+/* === Private variable declarations =========================================================== */
+
+static gesture_t gesture;
+static gesture_event_t events[8];
+
+/* === Private function declarations =========================================================== */
+
+/* === Public variable definitions ============================================================= */
+
+/* === Private variable definitions ============================================================ */
+
+/* === Private function implementation ========================================================= */
+
+/* === Public function implementation ========================================================= */
+
+void setUp(void) {
+    GestureInit(&gesture, BIT(KEY_UP) | BIT(KEY_DOWN), BIT(KEY_LONG));
+    GestureAddChord(&gesture, BIT(KEY_UP) | BIT(KEY_DOWN));
+}
+
+/**
+ * @brief Verifica que una tecla sin repetición ni pulsación larga informa solo la pulsación.
+ */
+
+void test_gesture_plain_press(void) {
+    TEST_ASSERT_EQUAL(1, GestureUpdate(&gesture, BIT(KEY_PLAIN), 0, events, 8));
+    TEST_ASSERT_EQUAL(GESTURE_PRESS, events[0].kind);
+    TEST_ASSERT_EQUAL(KEY_PLAIN, events[0].key);
+    TEST_ASSERT_EQUAL(1, events[0].steps);
+
+    TEST_ASSERT_EQUAL(GESTURE_NO_DEADLINE, GestureDeadline(&gesture, 0));
+    TEST_ASSERT_EQUAL(0, GestureUpdate(&gesture, BIT(KEY_PLAIN), 5000, events, 8));
+    TEST_ASSERT_EQUAL(0, GestureUpdate(&gesture, 0, 5010, events, 8));
+}
+
+/**
+ * @brief Verifica que la pulsación larga se informa una sola vez, después de la pulsación.
+ */
+
+void test_gesture_long_press(void) {
+    TEST_ASSERT_EQUAL(1, GestureUpdate(&gesture, BIT(KEY_LONG), 100, events, 8));
+    TEST_ASSERT_EQUAL(GESTURE_LONG_PRESS_MS, GestureDeadline(&gesture, 100));
+
+    TEST_ASSERT_EQUAL(0, GestureUpdate(&gesture, BIT(KEY_LONG), 100 + GESTURE_LONG_PRESS_MS - 1, events, 8));
+    TEST_ASSERT_EQUAL(1, GestureUpdate(&gesture, BIT(KEY_LONG), 100 + GESTURE_LONG_PRESS_MS, events, 8));
+    TEST_ASSERT_EQUAL(GESTURE_LONG_PRESS, events[0].kind);
+    TEST_ASSERT_EQUAL(KEY_LONG, events[0].key);
+
+    TEST_ASSERT_EQUAL(0, GestureUpdate(&gesture, BIT(KEY_LONG), 5000, events, 8));
+    TEST_ASSERT_EQUAL(GESTURE_NO_DEADLINE, GestureDeadline(&gesture, 5000));
+}
+
+/**
+ * @brief Verifica que una tecla mantenida repite y que cada GESTURE_ACCEL_REPEATS repeticiones aumenta el paso.
+ */
+
+void test_gesture_repeat_accelerates(void) {
+    uint32_t now = 0;
+    uint16_t total = 0;
+
+    // La pulsación de una tecla de acorde se informa cuando vence el tiempo del acorde
+    GestureUpdate(&gesture, BIT(KEY_UP), now, events, 8);
+    TEST_ASSERT_EQUAL(1, GestureUpdate(&gesture, BIT(KEY_UP), GESTURE_CHORD_MS, events, 8));
+    TEST_ASSERT_EQUAL(GESTURE_PRESS, events[0].kind);
+
+    now = GESTURE_LONG_PRESS_MS;
+    for (int repeat = 0; repeat < 3 * GESTURE_ACCEL_REPEATS; repeat++) {
+        TEST_ASSERT_EQUAL(0, GestureDeadline(&gesture, now));
+        TEST_ASSERT_EQUAL(1, GestureUpdate(&gesture, BIT(KEY_UP), now, events, 8));
+        TEST_ASSERT_EQUAL(GESTURE_REPEAT, events[0].kind);
+        TEST_ASSERT_EQUAL(KEY_UP, events[0].key);
+        total += events[0].steps;
+        if (repeat == GESTURE_ACCEL_REPEATS - 1) {
+            TEST_ASSERT_EQUAL(1, events[0].steps);
+        } else if (repeat == GESTURE_ACCEL_REPEATS) {
+            TEST_ASSERT_EQUAL(2, events[0].steps);
+        }
+        TEST_ASSERT_EQUAL(GESTURE_REPEAT_MS, GestureDeadline(&gesture, now));
+        now += GESTURE_REPEAT_MS;
+    }
+    TEST_ASSERT_EQUAL(5 * (1 + 2 + 5), total);
+
+    TEST_ASSERT_EQUAL(1, GestureUpdate(&gesture, BIT(KEY_UP), now, events, 8));
+    TEST_ASSERT_EQUAL(10, events[0].steps);
+    TEST_ASSERT_EQUAL(0, GestureUpdate(&gesture, 0, now + 1, events, 8));
+    TEST_ASSERT_EQUAL(GESTURE_NO_DEADLINE, GestureDeadline(&gesture, now + 1));
+}
+
+/**
+ * @brief Verifica que si la actualización se atrasa, las repeticiones vencidas llegan en un solo evento.
+ */
+
+void test_gesture_late_repeats_are_coalesced(void) {
+    GestureUpdate(&gesture, BIT(KEY_DOWN), 0, events, 8);
+    GestureUpdate(&gesture, BIT(KEY_DOWN), GESTURE_CHORD_MS, events, 8);
+
+    TEST_ASSERT_EQUAL(1, GestureUpdate(&gesture, BIT(KEY_DOWN), GESTURE_LONG_PRESS_MS + 3 * GESTURE_REPEAT_MS,
+                                       events, 8));
+    TEST_ASSERT_EQUAL(GESTURE_REPEAT, events[0].kind);
+    TEST_ASSERT_EQUAL(4, events[0].steps);
+}
+
+/**
+ * @brief Verifica que dos teclas presionadas dentro del tiempo del acorde generan solo el acorde, sin pulsaciones ni
+ * repeticiones mientras se mantienen.
+ */
+
+void test_gesture_chord(void) {
+    TEST_ASSERT_EQUAL(0, GestureUpdate(&gesture, BIT(KEY_UP), 0, events, 8));
+    TEST_ASSERT_EQUAL(GESTURE_CHORD_MS, GestureDeadline(&gesture, 0));
+
+    TEST_ASSERT_EQUAL(1, GestureUpdate(&gesture, BIT(KEY_UP) | BIT(KEY_DOWN), 30, events, 8));
+    TEST_ASSERT_EQUAL(GESTURE_CHORD, events[0].kind);
+    TEST_ASSERT_EQUAL(0, events[0].key);
+
+    TEST_ASSERT_EQUAL(GESTURE_NO_DEADLINE, GestureDeadline(&gesture, 30));
+    TEST_ASSERT_EQUAL(0, GestureUpdate(&gesture, BIT(KEY_UP) | BIT(KEY_DOWN), 3000, events, 8));
+    TEST_ASSERT_EQUAL(0, GestureUpdate(&gesture, BIT(KEY_DOWN), 3010, events, 8));
+    TEST_ASSERT_EQUAL(0, GestureUpdate(&gesture, 0, 3020, events, 8));
+}
+
+/**
+ * @brief Verifica que un toque corto de una tecla de acorde se informa al soltarla.
+ */
+
+void test_gesture_chord_key_tap(void) {
+    TEST_ASSERT_EQUAL(0, GestureUpdate(&gesture, BIT(KEY_DOWN), 0, events, 8));
+    TEST_ASSERT_EQUAL(1, GestureUpdate(&gesture, 0, 40, events, 8));
+    TEST_ASSERT_EQUAL(GESTURE_PRESS, events[0].kind);
+    TEST_ASSERT_EQUAL(KEY_DOWN, events[0].key);
+}
+
+/**
+ * @brief Verifica que los eventos que no entran en la lista se descartan sin escribir fuera de ella.
+ */
+
+void test_gesture_events_limited_to_size(void) {
+    GestureInit(&gesture, 0, 0);
+
+    TEST_ASSERT_EQUAL(1, GestureUpdate(&gesture, BIT(0) | BIT(1) | BIT(4), 0, events, 1));
+    TEST_ASSERT_EQUAL(0, events[0].key);
+}
+
+/* === End of documentation ==================================================================== */
+
+/** @} End of module definition for doxygen */
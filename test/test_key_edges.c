@@ -0,0 +1,177 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Roldan JesusAlejandro <kechuroldanjesus@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+/** @file test_key_edges.c
+ ** @brief Pruebas unitarias de la cola de flancos de las teclas, alimentada por la fuente de interrupciones
+ * simulada del host:
+ * - Orden y marca de tiempo de los flancos.
+ * - Descarte cuando la cola está llena.
+ * - Rebotes y varias teclas a la vez.
+ * - Demora entre el flanco y su atención.
+ **/
+
+/* === Headers files inclusions =============================================================== */
+
+#include "unity.h"
+#include "key_edges.h"
+#include "key_interrupt_host.h"
+
+/* === Macros definitions ====================================================================== */
+
+/* === Private data type declarations ========================================================== */
+
+/* === Private variable declarations =========================================================== */
+
+static key_edges_t edges;
+
+/* === Private function declarations =========================================================== */
+
+static void KeyEdgeInterrupt(uint8_t key, bool active, uint32_t timestamp, void * context);
+
+/* === Public variable definitions ============================================================= */
+
+/* === Private variable definitions ============================================================ */
+
+/* === Private function implementation ========================================================= */
+
+static void KeyEdgeInterrupt(uint8_t key, bool active, uint32_t timestamp, void * context) {
+    // Lo mismo que hace la rutina de interrupción de la tarea de botones
+    KeyEdgesPush(context, key, active, timestamp);
+}
+
+/* === Public function implementation ========================================================= */
+
+void setUp(void) {
+    KeyEdgesInit(&edges);
+    KeyInterruptHostInit(KeyEdgeInterrupt, &edges);
+}
+
+/**
+ * @brief Verifica que sin flancos la cola está vacía.
+ */
+
+void test_key_edges_empty_without_interrupts(void) {
+    key_edge_t edge;
+
+    TEST_ASSERT_FALSE(KeyEdgesPop(&edges, &edge));
+    KeyInterruptHostSet(2, false, 10);  // Sin cambio de nivel no hay interrupción
+    TEST_ASSERT_FALSE(KeyEdgesPop(&edges, &edge));
+}
+
+/**
+ * @brief Verifica que una pulsación limpia genera un flanco de activación y uno de liberación, en orden y con su
+ * marca de tiempo.
+ */
+
+void test_key_edges_press_and_release_in_order(void) {
+    key_edge_t edge;
+
+    KeyInterruptHostSet(3, true, 100);
+    KeyInterruptHostSet(3, false, 250);
+
+    TEST_ASSERT_TRUE(KeyEdgesPop(&edges, &edge));
+    TEST_ASSERT_EQUAL(3, edge.key);
+    TEST_ASSERT_TRUE(edge.active);
+    TEST_ASSERT_EQUAL(100, edge.timestamp);
+
+    TEST_ASSERT_TRUE(KeyEdgesPop(&edges, &edge));
+    TEST_ASSERT_FALSE(edge.active);
+    TEST_ASSERT_EQUAL(250, edge.timestamp);
+    TEST_ASSERT_FALSE(KeyEdgesPop(&edges, &edge));
+}
+
+/**
+ * @brief Verifica que los rebotes llegan como flancos alternados y que el último deja la tecla activa.
+ */
+
+void test_key_edges_bounces_end_in_final_state(void) {
+    key_edge_t edge;
+    uint32_t count = 0;
+    uint32_t last_timestamp = 0;
+    bool last_active = false;
+
+    uint32_t stable = KeyInterruptHostBounce(1, true, 40, 3);
+
+    while (KeyEdgesPop(&edges, &edge)) {
+        TEST_ASSERT_TRUE(edge.active != last_active);
+        TEST_ASSERT_GREATER_OR_EQUAL(last_timestamp, edge.timestamp);
+        last_active = edge.active;
+        last_timestamp = edge.timestamp;
+        count++;
+    }
+    TEST_ASSERT_EQUAL(7, count);
+    TEST_ASSERT_TRUE(last_active);
+    TEST_ASSERT_EQUAL(stable, last_timestamp);
+}
+
+/**
+ * @brief Verifica que los flancos de varias teclas se intercalan sin perder a qué tecla pertenecen.
+ */
+
+void test_key_edges_several_keys(void) {
+    key_edge_t edge;
+
+    KeyInterruptHostSet(0, true, 5);
+    KeyInterruptHostSet(4, true, 6);
+    KeyInterruptHostSet(0, false, 7);
+
+    KeyEdgesPop(&edges, &edge);
+    TEST_ASSERT_EQUAL(0, edge.key);
+    KeyEdgesPop(&edges, &edge);
+    TEST_ASSERT_EQUAL(4, edge.key);
+    KeyEdgesPop(&edges, &edge);
+    TEST_ASSERT_EQUAL(0, edge.key);
+    TEST_ASSERT_FALSE(edge.active);
+}
+
+/**
+ * @brief Verifica que con la cola llena se descartan los flancos nuevos y se cuentan, sin perder los anteriores.
+ */
+
+void test_key_edges_overrun_keeps_oldest(void) {
+    key_edge_t edge;
+
+    for (uint32_t index = 0; index < KEY_EDGES_CAPACITY + 3; index++) {
+        KeyInterruptHostSet(0, (index % 2) == 0, index);
+    }
+
+    TEST_ASSERT_EQUAL(3, edges.overruns);
+    TEST_ASSERT_TRUE(KeyEdgesPop(&edges, &edge));
+    TEST_ASSERT_EQUAL(0, edge.timestamp);
+    TEST_ASSERT_TRUE(KeyEdgesPush(&edges, 0, true, 99));
+}
+
+/**
+ * @brief Verifica que vaciar la cola informa las teclas con flancos y la mayor demora hasta atenderlos.
+ */
+
+void test_key_edges_drain_measures_latency(void) {
+    KeyInterruptHostBounce(1, true, 100, 2);
+    KeyInterruptHostSet(4, true, 103);
+
+    TEST_ASSERT_EQUAL_HEX32((1u << 1) | (1u << 4), KeyEdgesDrain(&edges, 110));
+    TEST_ASSERT_EQUAL(6, edges.drained);
+    TEST_ASSERT_EQUAL(10, edges.max_latency);
+    TEST_ASSERT_EQUAL_HEX32(0, KeyEdgesDrain(&edges, 120));
+    TEST_ASSERT_EQUAL(10, edges.max_latency);
+}
+
+/* === End of documentation ==================================================================== */
+
+/** @} End of module definition for doxygen */
@@ -0,0 +1,173 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Roldan JesusAlejandro <kechuroldanjesus@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+/** @file test_max7219.c
+ ** @brief Pruebas unitarias del controlador de pantalla serie tipo MAX7219, decodificando lo que viaja por el bus:
+ * - Configuración de los controladores encadenados.
+ * - Imagen recibida por cada controlador.
+ * - Envío solo de los dígitos que cambiaron, y nada si la imagen no cambió.
+ * - Parpadeo con un controlador externo.
+ **/
+
+/* === Headers files inclusions =============================================================== */
+
+#include "unity.h"
+#include "screen.h"
+#include "max7219.h"
+#include "max7219_host.h"
+#include "timebase_host.h"
+
+/* === Macros definitions ====================================================================== */
+
+/* === Private data type declarations ========================================================== */
+
+/* === Private variable declarations =========================================================== */
+
+static ScreenT screen;
+
+static const clock_time_t TIME_123456 = {.time = {.seconds = {6, 5}, .minutes = {4, 3}, .hours = {2, 1}}};
+
+// Segmentos de cada número en el orden de screen.h
+static const uint8_t DIGIT_IMAGES[10] = {0x3F, 0x06, 0x5B, 0x4F, 0x66, 0x6D, 0x7D, 0x07, 0x7F, 0x6F};
+
+/* === Private function declarations =========================================================== */
+
+static ScreenT CreateScreen(uint8_t chips, uint8_t digits_per_chip);
+
+/* === Public variable definitions ============================================================= */
+
+/* === Private variable definitions ============================================================ */
+
+/* === Private function implementation ========================================================= */
+
+static ScreenT CreateScreen(uint8_t chips, uint8_t digits_per_chip) {
+    return ScreenCreate(chips * digits_per_chip, Max7219Create(Max7219Host(chips), chips, digits_per_chip));
+}
+
+/* === Public function implementation ========================================================= */
+
+void tearDown(void) {
+    TimebaseHost()->Stop();
+}
+
+// Cada controlador queda sin decodificación BCD, multiplexando sus dígitos, encendido y sin la prueba de pantalla
+void test_create_configures_every_chip(void) {
+    TEST_ASSERT_NOT_NULL(Max7219Create(Max7219Host(2), 2, 4));
+
+    for (uint8_t chip = 0; chip < 2; chip++) {
+        TEST_ASSERT_EQUAL_HEX8(0x00, Max7219HostRegister(chip, 0x09));
+        TEST_ASSERT_EQUAL_HEX8(MAX7219_INTENSITY, Max7219HostRegister(chip, 0x0A));
+        TEST_ASSERT_EQUAL_HEX8(3, Max7219HostRegister(chip, 0x0B));
+        TEST_ASSERT_EQUAL_HEX8(0x01, Max7219HostRegister(chip, 0x0C));
+        TEST_ASSERT_EQUAL_HEX8(0x00, Max7219HostRegister(chip, 0x0F));
+    }
+    TEST_ASSERT_EQUAL_UINT32(0, Max7219HostErrors());
+}
+
+// La cantidad de controladores y de dígitos por controlador tienen límites
+void test_create_rejects_invalid_arguments(void) {
+    TEST_ASSERT_NULL(Max7219Create(NULL, 1, 4));
+    TEST_ASSERT_NULL(Max7219Create(Max7219Host(1), 0, 4));
+    TEST_ASSERT_NULL(Max7219Create(Max7219Host(1), MAX7219_MAX_CHIPS + 1, 4));
+    TEST_ASSERT_NULL(Max7219Create(Max7219Host(1), 1, 0));
+    TEST_ASSERT_NULL(Max7219Create(Max7219Host(1), 1, MAX7219_CHIP_DIGITS + 1));
+}
+
+// Lo que recibe el controlador es la imagen publicada, con los puntos decimales
+void test_frame_reaches_chip(void) {
+    uint8_t segments[4];
+
+    screen = CreateScreen(1, 4);
+    ScreenWriteLayout(screen, &SCREEN_LAYOUT_HHMM, TIME_123456.bcd, 0x02);
+    ScreenRefresh(screen);
+
+    Max7219HostFrame(segments, 4, 4);
+    for (int digit = 0; digit < 4; digit++) {
+        TEST_ASSERT_EQUAL_HEX8(DIGIT_IMAGES[digit + 1] | (digit == 1 ? SEGMENT_P : 0), segments[digit]);
+    }
+}
+
+// Sin cambios en la imagen los refrescos no envían nada, y un cambio envía solo los dígitos distintos
+void test_only_changes_are_sent(void) {
+    screen = CreateScreen(1, 4);
+    ScreenWriteLayout(screen, &SCREEN_LAYOUT_HHMM, TIME_123456.bcd, 0);
+    ScreenRefresh(screen);
+    uint32_t loads = Max7219HostLoads();
+
+    for (int frame = 0; frame < 100; frame++) {
+        ScreenRefresh(screen);
+    }
+    TEST_ASSERT_EQUAL_UINT32(loads, Max7219HostLoads());
+
+    ScreenWriteLayout(screen, &SCREEN_LAYOUT_HHMM, (uint8_t[]){0, 0, 5, 3, 2, 1}, 0);
+    ScreenRefresh(screen);
+    ScreenRefresh(screen);
+    TEST_ASSERT_EQUAL_UINT32(loads + 1, Max7219HostLoads());
+    TEST_ASSERT_EQUAL_HEX8(0x5B, Max7219HostRegister(0, 4)); // El 5 en el orden de los controladores
+    TEST_ASSERT_EQUAL_UINT32(2, Max7219Stats()->frames); // Solo dos de los refrescos llegaron al controlador
+}
+
+// Dos controladores de cuatro dígitos forman una pantalla de ocho y cada carga actualiza los dos
+void test_daisy_chain_shows_eight_digits(void) {
+    static const uint8_t expected[8] = {1, 2, 0, 3, 4, 0, 5, 6};
+    uint8_t segments[8];
+
+    screen = CreateScreen(2, 4);
+    ScreenWriteLayout(screen, &SCREEN_LAYOUT_HH_MM_SS, TIME_123456.bcd, 0);
+    ScreenRefresh(screen);
+
+    Max7219HostFrame(segments, 8, 4);
+    for (int digit = 0; digit < 8; digit++) {
+        TEST_ASSERT_EQUAL_HEX8(expected[digit] ? DIGIT_IMAGES[expected[digit]] : 0, segments[digit]);
+    }
+    TEST_ASSERT_EQUAL_UINT32(0, Max7219HostErrors());
+    TEST_ASSERT_EQUAL_UINT32(16u * 2 * Max7219HostLoads(), Max7219Stats()->bits);
+}
+
+// El parpadeo reenvía los dígitos del grupo solo cuando cambia de mitad
+void test_blink_is_sent_on_phase_changes(void) {
+    uint8_t segments[4];
+
+    screen = CreateScreen(1, 4);
+    ScreenWriteLayout(screen, &SCREEN_LAYOUT_HHMM, TIME_123456.bcd, 0);
+    DisplayFlashDigits(screen, 0, 1, 2);
+
+    ScreenRefresh(screen);
+    Max7219HostFrame(segments, 4, 4);
+    TEST_ASSERT_EQUAL_HEX8(0, segments[0]);
+    TEST_ASSERT_EQUAL_HEX8(DIGIT_IMAGES[3], segments[2]);
+
+    uint32_t loads = Max7219HostLoads();
+    ScreenRefresh(screen);
+    TEST_ASSERT_EQUAL_UINT32(loads, Max7219HostLoads());
+
+    ScreenRefresh(screen);
+    Max7219HostFrame(segments, 4, 4);
+    TEST_ASSERT_EQUAL_HEX8(DIGIT_IMAGES[1], segments[0]);
+    TEST_ASSERT_EQUAL_UINT32(loads + 2, Max7219HostLoads());
+}
+
+// Con un controlador externo el temporizador genera una llamada por imagen, no una por dígito
+void test_start_runs_once_per_frame(void) {
+    screen = CreateScreen(2, 4);
+    TEST_ASSERT_TRUE(ScreenStart(screen, TimebaseHost(), SCREEN_FRAME_RATE_HZ));
+    TEST_ASSERT_EQUAL_UINT32(SCREEN_FRAME_RATE_HZ, TimebaseHostFrequency());
+}
+
+/* === End of documentation ==================================================================== */
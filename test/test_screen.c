@@ -0,0 +1,482 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Roldan JesusAlejandro <kechuroldanjesus@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+/** @file test_screen.c
+ ** @brief Pruebas unitarias del módulo `screen` con un controlador que registra lo que se escribe en la pantalla:
+ * - Imagen que se muestra e imagen de trabajo.
+ * - Codificación de la hora en BCD.
+ * - Codificación solo de los dígitos y puntos que cambiaron.
+ * - Palabras de los puertos calculadas al publicar la imagen.
+ * - Grupos de parpadeo independientes.
+ * - Diseños de cuatro, seis y ocho dígitos.
+ * - Multiplexado desde la interrupción de un temporizador y medición del tiempo encendido.
+ **/
+
+/* === Headers files inclusions =============================================================== */
+
+#include "unity.h"
+#include "screen.h"
+#include "timebase_host.h"
+
+/* === Macros definitions ====================================================================== */
+
+#define TEST_DIGITS 4
+
+/* === Private data type declarations ========================================================== */
+
+/* === Private variable declarations =========================================================== */
+
+static ScreenT screen;
+static uint8_t shown_segments[SCREEN_MAX_DIGITS]; // Lo último que se escribió en cada dígito
+static uint8_t shown_points[SCREEN_MAX_DIGITS];
+static uint8_t segments_latch;              // Segmentos escritos antes de encender el dígito
+static uint8_t points_latch;
+
+/* === Private function declarations =========================================================== */
+
+static void MockDigitsTurnOff(void);
+
+static void MockSegmentsUpdate(uint8_t segments, uint8_t points);
+
+static void MockDigitsTurnOn(uint8_t digit);
+
+static void RefreshAll(void);
+
+static void MockWriteDigitFrame(const screen_digit_frame_t * frame);
+
+static void StartFrames(void);
+
+static void RefreshDigits(uint8_t digits);
+
+static uint32_t MockTimestamp(void);
+
+/* === Public variable definitions ============================================================= */
+
+/* === Private variable definitions ============================================================ */
+
+static const struct screen_driver_s mock_driver = {
+    .DigitsTurnOff = MockDigitsTurnOff,
+    .SegmentsUpdate = MockSegmentsUpdate,
+    .DigitsTurnOn = MockDigitsTurnOn,
+};
+
+static const uint32_t mock_digit_words[TEST_DIGITS] = {0x08, 0x04, 0x02, 0x01};
+
+static const struct screen_driver_s mock_frame_driver = {
+    .WriteDigitFrame = MockWriteDigitFrame,
+    .digit_words = mock_digit_words,
+    .point_word = 1u << 16,
+};
+
+static screen_digit_frame_t written_frames[TEST_DIGITS]; // Última palabra escrita para cada dígito
+static uint32_t frame_writes;
+static uint8_t frame_order[2 * TEST_DIGITS];              // Dígitos en el orden en que se encendieron
+
+static uint32_t now_us; // Lo que devuelve MockTimestamp
+
+static const struct screen_driver_s mock_timed_driver = {
+    .WriteDigitFrame = MockWriteDigitFrame,
+    .digit_words = mock_digit_words,
+    .point_word = 1u << 16,
+    .Timestamp = MockTimestamp,
+};
+
+static const clock_time_t TIME_1234 = {.time = {.seconds = {0, 0}, .minutes = {4, 3}, .hours = {2, 1}}};
+static const clock_time_t TIME_123456 = {.time = {.seconds = {6, 5}, .minutes = {4, 3}, .hours = {2, 1}}};
+
+// Segmentos de cada número, para comparar diseños largos
+static const uint8_t DIGIT_IMAGES[10] = {0x3F, 0x06, 0x5B, 0x4F, 0x66, 0x6D, 0x7D, 0x07, 0x7F, 0x6F};
+
+/* === Private function implementation ========================================================= */
+
+static void MockDigitsTurnOff(void) {
+}
+
+static void MockSegmentsUpdate(uint8_t segments, uint8_t points) {
+    segments_latch = segments;
+    points_latch = points;
+}
+
+static void MockDigitsTurnOn(uint8_t digit) {
+    shown_segments[digit] = segments_latch;
+    shown_points[digit] = points_latch;
+}
+
+static void MockWriteDigitFrame(const screen_digit_frame_t * frame) {
+    for (int digit = 0; digit < TEST_DIGITS; digit++) {
+        if (mock_digit_words[digit] == frame->digit) {
+            written_frames[digit] = *frame;
+            if (frame_writes < sizeof(frame_order)) {
+                frame_order[frame_writes] = digit;
+            }
+        }
+    }
+    frame_writes++;
+}
+
+static void RefreshDigits(uint8_t digits) {
+    for (int digit = 0; digit < digits; digit++) {
+        ScreenRefresh(screen);
+    }
+}
+
+// Deja el multiplexado en el último dígito: desde ahí cada RefreshAll muestra una imagen completa
+static void StartFrames(void) {
+    screen = ScreenCreate(TEST_DIGITS, &mock_frame_driver);
+    ScreenWriteBCD(screen, &TIME_1234, false, (uint8_t[]){0, 0, 0, 1});
+    for (int digit = 1; digit < TEST_DIGITS; digit++) {
+        ScreenRefresh(screen);
+    }
+}
+
+static uint32_t MockTimestamp(void) {
+    return now_us;
+}
+
+static void RefreshAll(void) {
+    for (int digit = 0; digit < TEST_DIGITS; digit++) {
+        ScreenRefresh(screen);
+    }
+}
+
+/* === Public function implementation ========================================================= */
+
+void setUp(void) {
+    screen = ScreenCreate(TEST_DIGITS, &mock_driver);
+}
+
+void tearDown(void) {
+    TimebaseHost()->Stop();
+    ScreenDestroy(screen);
+}
+
+// Sin controlador no se crea la pantalla
+void test_create_without_driver_fails(void) {
+    TEST_ASSERT_NULL(ScreenCreate(TEST_DIGITS, NULL));
+}
+
+// La hora se codifica en la imagen publicada con sus puntos decimales
+void test_write_bcd_shows_hours_and_minutes(void) {
+    ScreenWriteBCD(screen, &TIME_1234, false, (uint8_t[]){0, 1, 0, 1});
+    RefreshAll();
+
+    TEST_ASSERT_EQUAL_HEX8(SEGMENT_B | SEGMENT_C, shown_segments[0]);
+    TEST_ASSERT_EQUAL_HEX8(SEGMENT_A | SEGMENT_B | SEGMENT_D | SEGMENT_E | SEGMENT_G, shown_segments[1]);
+    TEST_ASSERT_EQUAL_HEX8(SEGMENT_A | SEGMENT_B | SEGMENT_C | SEGMENT_D | SEGMENT_G, shown_segments[2]);
+    TEST_ASSERT_EQUAL_HEX8(SEGMENT_B | SEGMENT_C | SEGMENT_F | SEGMENT_G, shown_segments[3]);
+    TEST_ASSERT_EQUAL_HEX8(0, shown_points[0]);
+    TEST_ASSERT_EQUAL_HEX8(SEGMENT_P, shown_points[1]);
+    TEST_ASSERT_EQUAL_HEX8(SEGMENT_P, shown_points[3]);
+}
+
+// Lo que se compone en la imagen de trabajo no se muestra hasta publicarla
+void test_back_frame_is_hidden_until_swap(void) {
+    ScreenWriteBCD(screen, &TIME_1234, false, (uint8_t[]){0, 0, 0, 0});
+
+    screen_frame_t * frame = ScreenBeginFrame(screen);
+    frame->segments[0] = SEGMENT_G;
+    RefreshAll();
+    TEST_ASSERT_EQUAL_HEX8(SEGMENT_B | SEGMENT_C, shown_segments[0]);
+
+    ScreenSwapFrame(screen);
+    RefreshAll();
+    TEST_ASSERT_EQUAL_HEX8(SEGMENT_G, shown_segments[0]);
+    TEST_ASSERT_EQUAL_HEX8(0, shown_segments[1]);
+}
+
+// La imagen de trabajo se entrega vacía aunque la anterior tuviera contenido
+void test_begin_frame_returns_cleared_frame(void) {
+    ScreenWriteBCD(screen, &TIME_1234, false, (uint8_t[]){1, 1, 1, 1});
+    ScreenWriteBCD(screen, &TIME_1234, false, (uint8_t[]){1, 1, 1, 1});
+
+    screen_frame_t * frame = ScreenBeginFrame(screen);
+    for (int digit = 0; digit < SCREEN_MAX_DIGITS; digit++) {
+        TEST_ASSERT_EQUAL_HEX8(0, frame->segments[digit]);
+        TEST_ASSERT_EQUAL_HEX8(0, frame->points[digit]);
+    }
+}
+
+// ScreenWriteBCD no hace nada si la hora y los puntos no cambiaron, y con segundos muestra MM:SS
+void test_write_bcd_skips_unchanged_time(void) {
+    TEST_ASSERT_EQUAL_UINT8(4, ScreenWriteBCD(screen, &TIME_1234, false, (uint8_t[]){0, 0, 0, 0}));
+    TEST_ASSERT_EQUAL_UINT8(0, ScreenWriteBCD(screen, &TIME_1234, false, (uint8_t[]){0, 0, 0, 0}));
+    TEST_ASSERT_EQUAL_UINT8(5, ScreenWriteBCD(screen, &TIME_1234, false, (uint8_t[]){0, 1, 0, 0}));
+
+    ScreenWriteBCD(screen, &TIME_1234, true, (uint8_t[]){0, 0, 0, 0});
+    RefreshAll();
+    TEST_ASSERT_EQUAL_HEX8(SEGMENT_A | SEGMENT_B | SEGMENT_C | SEGMENT_D | SEGMENT_G, shown_segments[0]);
+    TEST_ASSERT_EQUAL_HEX8(SEGMENT_A | SEGMENT_B | SEGMENT_C | SEGMENT_D | SEGMENT_E | SEGMENT_F, shown_segments[3]);
+}
+
+// Escribir lo mismo que ya se muestra no codifica nada
+void test_same_content_is_not_reencoded(void) {
+    TEST_ASSERT_EQUAL_UINT8(5, ScreenWriteDigits(screen, (uint8_t[]){1, 2, 3, 4}, 4, 0x02));
+    TEST_ASSERT_EQUAL_UINT8(0, ScreenWriteDigits(screen, (uint8_t[]){1, 2, 3, 4}, 4, 0x02));
+    RefreshAll();
+    TEST_ASSERT_EQUAL_HEX8(SEGMENT_B | SEGMENT_C, shown_segments[0]);
+    TEST_ASSERT_EQUAL_HEX8(SEGMENT_P, shown_points[1]);
+}
+
+// Cada imagen guarda su contenido: se codifican solo los dígitos que difieren de lo que tenía
+void test_only_changed_digits_are_encoded(void) {
+    ScreenWriteDigits(screen, (uint8_t[]){1, 2, 3, 4}, 4, 0);
+    TEST_ASSERT_EQUAL_UINT8(4, ScreenWriteDigits(screen, (uint8_t[]){1, 2, 3, 5}, 4, 0));
+    TEST_ASSERT_EQUAL_UINT8(1, ScreenWriteDigits(screen, (uint8_t[]){1, 2, 3, 6}, 4, 0));
+    RefreshAll();
+    TEST_ASSERT_EQUAL_HEX8(SEGMENT_A | SEGMENT_C | SEGMENT_D | SEGMENT_E | SEGMENT_F | SEGMENT_G, shown_segments[3]);
+    TEST_ASSERT_EQUAL_HEX8(SEGMENT_A | SEGMENT_B | SEGMENT_C | SEGMENT_D | SEGMENT_G, shown_segments[2]);
+}
+
+// Al alternar el punto se vuelve a la imagen anterior sin codificar nada
+void test_blinking_point_reuses_previous_frame(void) {
+    ScreenWriteDigits(screen, (uint8_t[]){1, 2, 3, 4}, 4, 0x02);
+    TEST_ASSERT_EQUAL_UINT8(4, ScreenWriteDigits(screen, (uint8_t[]){1, 2, 3, 4}, 4, 0x00));
+    TEST_ASSERT_EQUAL_UINT8(0, ScreenWriteDigits(screen, (uint8_t[]){1, 2, 3, 4}, 4, 0x02));
+    RefreshAll();
+    TEST_ASSERT_EQUAL_HEX8(SEGMENT_P, shown_points[1]);
+    TEST_ASSERT_EQUAL_UINT8(0, ScreenWriteDigits(screen, (uint8_t[]){1, 2, 3, 4}, 4, 0x00));
+    RefreshAll();
+    TEST_ASSERT_EQUAL_HEX8(0, shown_points[1]);
+    TEST_ASSERT_EQUAL_HEX8(SEGMENT_B | SEGMENT_C, shown_segments[0]);
+}
+
+// Una imagen compuesta a mano no se compara: la próxima escritura sobre ella la codifica completa
+void test_manual_frame_forces_full_encoding(void) {
+    ScreenWriteDigits(screen, (uint8_t[]){1, 2, 3, 4}, 4, 0);
+    ScreenBeginFrame(screen)->segments[0] = SEGMENT_G;
+    ScreenSwapFrame(screen);
+
+    TEST_ASSERT_EQUAL_UINT8(0, ScreenWriteDigits(screen, (uint8_t[]){1, 2, 3, 4}, 4, 0));
+    RefreshAll();
+    TEST_ASSERT_EQUAL_HEX8(SEGMENT_B | SEGMENT_C, shown_segments[0]);
+
+    TEST_ASSERT_EQUAL_UINT8(4, ScreenWriteDigits(screen, (uint8_t[]){1, 2, 3, 5}, 4, 0));
+    RefreshAll();
+    TEST_ASSERT_EQUAL_HEX8(SEGMENT_B | SEGMENT_C, shown_segments[0]);
+}
+
+// Con WriteDigitFrame cada refresco es una sola llamada con las palabras finales de los puertos
+void test_frame_driver_writes_port_words(void) {
+    screen = ScreenCreate(TEST_DIGITS, &mock_frame_driver);
+    frame_writes = 0;
+
+    ScreenWriteBCD(screen, &TIME_1234, false, (uint8_t[]){0, 1, 0, 0});
+    RefreshAll();
+
+    TEST_ASSERT_EQUAL_UINT32(TEST_DIGITS, frame_writes);
+    TEST_ASSERT_EQUAL_HEX32(SEGMENT_B | SEGMENT_C, written_frames[0].segments);
+    TEST_ASSERT_EQUAL_HEX32(0, written_frames[0].point);
+    TEST_ASSERT_EQUAL_HEX32(1u << 16, written_frames[1].point);
+    TEST_ASSERT_EQUAL_HEX32(SEGMENT_B | SEGMENT_C | SEGMENT_F | SEGMENT_G, written_frames[3].segments);
+}
+
+// El parpadeo apaga los segmentos de las palabras ya calculadas, pero sigue encendiendo el dígito
+void test_frame_driver_blinks_digits(void) {
+    screen = ScreenCreate(TEST_DIGITS, &mock_frame_driver);
+    ScreenWriteBCD(screen, &TIME_1234, false, (uint8_t[]){0, 0, 0, 0});
+    DisplayFlashDigits(screen, 0, 1, 50);
+
+    RefreshAll();
+    TEST_ASSERT_EQUAL_HEX32(0, written_frames[0].segments);
+    TEST_ASSERT_EQUAL_HEX32(0x08, written_frames[0].digit);
+    TEST_ASSERT_EQUAL_HEX32(SEGMENT_B | SEGMENT_C | SEGMENT_F | SEGMENT_G, written_frames[3].segments);
+}
+
+// Cada grupo parpadea con su propio período: las horas cada 4 imágenes y el punto de la alarma cada 2
+void test_blink_groups_are_independent(void) {
+    static const uint8_t hours_hidden[] = {1, 1, 0, 0, 1, 1};
+    static const uint8_t point_hidden[] = {1, 0, 1, 0, 1, 0};
+
+    StartFrames();
+    TEST_ASSERT_EQUAL_INT(0, ScreenBlink(screen, 2, 0x03, 0, 4, 0));
+    TEST_ASSERT_EQUAL_INT(0, ScreenBlink(screen, 3, 0, 0x08, 2, 0));
+
+    for (int frame = 0; frame < 6; frame++) {
+        RefreshAll();
+        TEST_ASSERT_EQUAL_HEX32(hours_hidden[frame] ? 0 : SEGMENT_B | SEGMENT_C, written_frames[0].segments);
+        TEST_ASSERT_EQUAL_HEX32(hours_hidden[frame] ? 0 : SEGMENT_A | SEGMENT_B | SEGMENT_D | SEGMENT_E | SEGMENT_G,
+                                written_frames[1].segments);
+        TEST_ASSERT_EQUAL_HEX32(point_hidden[frame] ? 0 : 1u << 16, written_frames[3].point);
+        TEST_ASSERT_EQUAL_HEX32(SEGMENT_A | SEGMENT_B | SEGMENT_C | SEGMENT_D | SEGMENT_G, written_frames[2].segments);
+        TEST_ASSERT_EQUAL_HEX32(0x02, written_frames[2].digit);
+    }
+}
+
+// Dos grupos del mismo período desfasados medio ciclo se alternan
+void test_blink_phase_offsets_groups(void) {
+    StartFrames();
+    ScreenBlink(screen, 0, 0x01, 0, 4, 0);
+    ScreenBlink(screen, 1, 0x02, 0, 4, 2);
+
+    for (int frame = 0; frame < 8; frame++) {
+        bool first_half = (frame % 4) < 2;
+        RefreshAll();
+        TEST_ASSERT_EQUAL_HEX32(first_half ? 0 : SEGMENT_B | SEGMENT_C, written_frames[0].segments);
+        TEST_ASSERT_EQUAL_HEX32(first_half ? SEGMENT_A | SEGMENT_B | SEGMENT_D | SEGMENT_E | SEGMENT_G : 0,
+                                written_frames[1].segments);
+    }
+}
+
+// Detener un grupo en su mitad oculta vuelve a mostrar sus dígitos en la imagen siguiente
+void test_stopping_blink_restores_digits(void) {
+    StartFrames();
+    DisplayFlashDigits(screen, 0, 3, 50);
+    RefreshAll();
+    TEST_ASSERT_EQUAL_HEX32(0, written_frames[3].segments);
+
+    TEST_ASSERT_EQUAL_INT(0, DisplayFlashDigits(screen, 0, 0, 0));
+    RefreshAll();
+    TEST_ASSERT_EQUAL_HEX32(SEGMENT_B | SEGMENT_C | SEGMENT_F | SEGMENT_G, written_frames[3].segments);
+    TEST_ASSERT_EQUAL_HEX32(SEGMENT_B | SEGMENT_C, written_frames[0].segments);
+}
+
+// Los grupos y períodos fuera de rango se rechazan
+void test_blink_rejects_invalid_arguments(void) {
+    TEST_ASSERT_EQUAL_INT(-1, ScreenBlink(screen, SCREEN_BLINK_GROUPS, 0x01, 0, 4, 0));
+    TEST_ASSERT_EQUAL_INT(-1, ScreenBlink(screen, 0, 0x01, 0, 1, 0));
+    TEST_ASSERT_EQUAL_INT(-1, DisplayFlashDigits(screen, 2, 1, 50));
+    TEST_ASSERT_EQUAL_INT(-1, ScreenBlink(NULL, 0, 0x01, 0, 4, 0));
+}
+
+// Seis dígitos muestran HH:MM:SS y el punto puede estar en cualquiera de ellos
+void test_six_digit_layout_shows_seconds(void) {
+    screen = ScreenCreate(6, &mock_driver);
+
+    TEST_ASSERT_EQUAL_UINT8(7, ScreenWriteLayout(screen, &SCREEN_LAYOUT_HHMMSS, TIME_123456.bcd, 0x20));
+    RefreshDigits(6);
+    for (int digit = 0; digit < 6; digit++) {
+        TEST_ASSERT_EQUAL_HEX8(DIGIT_IMAGES[digit + 1], shown_segments[digit]);
+    }
+    TEST_ASSERT_EQUAL_HEX8(SEGMENT_P, shown_points[5]);
+    TEST_ASSERT_EQUAL_UINT8(0, ScreenWriteLayout(screen, &SCREEN_LAYOUT_HHMMSS, TIME_123456.bcd, 0x20));
+}
+
+// Ocho dígitos con posiciones apagadas entre campos, y un diseño propio que toma la fecha de otro arreglo
+void test_eight_digit_layouts(void) {
+    static const screen_layout_t date_time = {.size = 8, .fields = {7, 6, 9, 8, 5, 4, 3, 2}};
+    // Hora 12:34 seguida de día 25 y mes 12, de las unidades a las decenas como clock_time_t.bcd
+    static const uint8_t date_bcd[10] = {0, 0, 4, 3, 2, 1, 5, 2, 2, 1};
+    static const uint8_t expected[8] = {2, 5, 1, 2, 1, 2, 3, 4};
+
+    screen = ScreenCreate(8, &mock_driver);
+    ScreenWriteLayout(screen, &SCREEN_LAYOUT_HH_MM_SS, TIME_123456.bcd, 0);
+    RefreshDigits(8);
+    TEST_ASSERT_EQUAL_HEX8(DIGIT_IMAGES[2], shown_segments[1]);
+    TEST_ASSERT_EQUAL_HEX8(0, shown_segments[2]);
+    TEST_ASSERT_EQUAL_HEX8(0, shown_segments[5]);
+    TEST_ASSERT_EQUAL_HEX8(DIGIT_IMAGES[6], shown_segments[7]);
+
+    ScreenWriteLayout(screen, &date_time, date_bcd, 0x08);
+    RefreshDigits(8);
+    for (int digit = 0; digit < 8; digit++) {
+        TEST_ASSERT_EQUAL_HEX8(DIGIT_IMAGES[expected[digit]], shown_segments[digit]);
+    }
+    TEST_ASSERT_EQUAL_HEX8(SEGMENT_P, shown_points[3]);
+}
+
+// Un diseño de otro tamaño que la pantalla se rechaza y deja la imagen que se mostraba
+void test_layout_must_match_screen(void) {
+    static const screen_layout_t too_long = {.size = SCREEN_MAX_DIGITS + 1};
+
+    screen = ScreenCreate(6, &mock_driver);
+    ScreenWriteLayout(screen, &SCREEN_LAYOUT_HHMMSS, TIME_123456.bcd, 0);
+    TEST_ASSERT_EQUAL_UINT8(0, ScreenWriteBCD(screen, &TIME_1234, false, (uint8_t[]){0, 0, 0, 0}));
+    TEST_ASSERT_EQUAL_UINT8(0, ScreenWriteLayout(screen, &SCREEN_LAYOUT_HH_MM_SS, TIME_123456.bcd, 0));
+    TEST_ASSERT_EQUAL_UINT8(0, ScreenWriteLayout(screen, &too_long, TIME_123456.bcd, 0));
+    RefreshDigits(6);
+
+    for (int digit = 0; digit < 6; digit++) {
+        TEST_ASSERT_EQUAL_HEX8(DIGIT_IMAGES[digit + 1], shown_segments[digit]);
+    }
+}
+
+// El tiempo encendido se reparte entre los dígitos para mantener las imágenes por segundo
+void test_on_time_scales_with_digits(void) {
+    TEST_ASSERT_EQUAL_UINT32(2500, ScreenOnTime(screen, 100));
+    TEST_ASSERT_EQUAL_UINT32(1666, ScreenOnTime(ScreenCreate(6, &mock_driver), 100));
+
+    screen = ScreenCreate(8, &mock_driver);
+    TEST_ASSERT_EQUAL_UINT32(1250, ScreenOnTime(screen, 100));
+    TEST_ASSERT_EQUAL_UINT32(0, ScreenOnTime(screen, 0));
+    ScreenStart(screen, TimebaseHost(), 100);
+    TEST_ASSERT_EQUAL_UINT32(800, TimebaseHostFrequency());
+}
+
+// El temporizador se programa para mostrar cada dígito frame_rate veces por segundo
+void test_start_programs_timer_per_digit(void) {
+    TEST_ASSERT_TRUE(ScreenStart(screen, TimebaseHost(), SCREEN_FRAME_RATE_HZ));
+    TEST_ASSERT_EQUAL_UINT32(SCREEN_FRAME_RATE_HZ * TEST_DIGITS, TimebaseHostFrequency());
+    TimebaseHost()->Stop();
+
+    TEST_ASSERT_TRUE(ScreenStart(screen, TimebaseHost(), 60));
+    TEST_ASSERT_EQUAL_UINT32(60 * TEST_DIGITS, TimebaseHostFrequency());
+    TEST_ASSERT_FALSE(ScreenStart(screen, TimebaseHost(), 0));
+}
+
+// Cada interrupción enciende el dígito siguiente, en orden y sin llamar a ScreenRefresh desde afuera
+void test_timer_interrupt_multiplexes_digits(void) {
+    screen = ScreenCreate(TEST_DIGITS, &mock_frame_driver);
+    frame_writes = 0;
+    ScreenWriteBCD(screen, &TIME_1234, false, (uint8_t[]){0, 0, 0, 0});
+    ScreenStart(screen, TimebaseHost(), SCREEN_FRAME_RATE_HZ);
+
+    TimebaseHostAdvance(2 * TEST_DIGITS);
+
+    TEST_ASSERT_EQUAL_UINT32(2 * TEST_DIGITS, frame_writes);
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(((uint8_t[]){1, 2, 3, 0, 1, 2, 3, 0}), frame_order, 2 * TEST_DIGITS);
+    TEST_ASSERT_EQUAL_HEX32(SEGMENT_B | SEGMENT_C, written_frames[0].segments);
+    TEST_ASSERT_EQUAL_UINT32(2 * TEST_DIGITS, ScreenRefreshStats(screen)->steps);
+}
+
+// Con Timestamp se mide cuánto quedó encendido cada dígito y cuántos pasos se perdieron
+void test_refresh_stats_measure_on_time(void) {
+    screen = ScreenCreate(TEST_DIGITS, &mock_timed_driver);
+    ScreenStart(screen, TimebaseHost(), SCREEN_FRAME_RATE_HZ);
+
+    now_us = 1000;
+    TimebaseHostAdvance(1); // Enciende el dígito 1
+    now_us += 2500;
+    TimebaseHostAdvance(1); // El dígito 1 estuvo encendido 2500 us
+    now_us += 2400;
+    TimebaseHostAdvance(1);
+    now_us += 2600;
+    TimebaseHostAdvance(1);
+    for (int step = 0; step < TEST_DIGITS; step++) {
+        now_us += 2500;
+        TimebaseHostAdvance(1);
+    }
+
+    const screen_refresh_stats_t * stats = ScreenRefreshStats(screen);
+    TEST_ASSERT_EQUAL_UINT32(2500, stats->on_min[1]);
+    TEST_ASSERT_EQUAL_UINT32(2500, stats->on_max[1]);
+    TEST_ASSERT_EQUAL_UINT32(2400, stats->on_min[2]);
+    TEST_ASSERT_EQUAL_UINT32(2500, stats->on_max[2]);
+    TEST_ASSERT_EQUAL_UINT32(2500, stats->on_min[3]);
+    TEST_ASSERT_EQUAL_UINT32(2600, stats->on_max[3]);
+    TEST_ASSERT_EQUAL_UINT32(0, stats->missed);
+
+    // Una interrupción atrasada muestra un solo dígito y cuenta los períodos perdidos
+    TimebaseHost()->Suspend();
+    TimebaseHostAdvance(3);
+    TimebaseHost()->Resume();
+    TEST_ASSERT_EQUAL_UINT32(2 * TEST_DIGITS + 1, stats->steps);
+    TEST_ASSERT_EQUAL_UINT32(2, stats->missed);
+}
+
+/* === End of documentation ==================================================================== */
@@ -0,0 +1,189 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Roldan JesusAlejandro <kechuroldanjesus@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+/** @file test_task_timing.c
+ ** @brief Pruebas unitarias del módulo `task_timing` y simulación en el host de la tarea del reloj:
+ * - Histograma de jitter y deriva de una tarea periódica.
+ * - Comparación de un retardo relativo (vTaskDelay) con un plazo absoluto (vTaskDelayUntil) durante un día.
+ **/
+
+/* === Headers files inclusions =============================================================== */
+
+#include "unity.h"
+#include "task_timing.h"
+#include "clock.h"
+
+/* === Macros definitions ====================================================================== */
+
+#define TICK_US         1000u   // Duración de un tick del sistema simulado
+#define WORK_US         20u     // Trabajo normal de la tarea del reloj en cada activación
+#define STALL_US        2600u   // Demora ocasional, por ejemplo esperando un mutex
+#define STALL_EVERY     997u    // Cada cuántas activaciones ocurre la demora
+#define TICKS_PER_HOUR  3600000u
+#define TICKS_PER_DAY   86400000u
+
+/* === Private data type declarations ========================================================== */
+
+/* === Private variable declarations =========================================================== */
+
+/* === Private function declarations =========================================================== */
+
+static uint32_t SimulateClockTask(clock_t clock, task_timing_t * timing, bool absolute, uint32_t ticks);
+
+/* === Public variable definitions ============================================================= */
+
+/* === Private variable definitions ============================================================ */
+
+/* === Private function implementation ========================================================= */
+
+/**
+ * @brief Simula la tarea del reloj con un período de un tick durante la cantidad de ticks del sistema indicada.
+ *
+ * Con absolute en false la tarea espera un tick después de terminar su trabajo, como vTaskDelay; con absolute en
+ * true espera hasta el siguiente plazo, como vTaskDelayUntil, y si ya pasó vuelve a ejecutarse enseguida.
+ *
+ * @return Cantidad de veces que se llamó a ClockNewTick.
+ */
+
+static uint32_t SimulateClockTask(clock_t clock, task_timing_t * timing, bool absolute, uint32_t ticks) {
+    uint64_t end = (uint64_t)ticks * TICK_US;
+    uint64_t now = 0;
+    uint32_t deadline = 0;
+    uint32_t calls = 0;
+
+    TaskTimingInit(timing, 0, 1);
+    while (now < end) {
+        ClockNewTick(clock);
+        calls++;
+        now += WORK_US + ((calls % STALL_EVERY) == 0 ? STALL_US : 0);
+
+        if (absolute) {
+            deadline++;
+            if (now < (uint64_t)deadline * TICK_US) {
+                now = (uint64_t)deadline * TICK_US;
+            }
+        } else {
+            now = (now / TICK_US + 1) * TICK_US;
+        }
+
+        if (now < end) {
+            TaskTimingActivation(timing, (uint32_t)(now / TICK_US));
+        }
+    }
+    return calls;
+}
+
+/* === Public function implementation ========================================================= */
+
+/**
+ * @brief Verifica que las activaciones puntuales quedan en el centro del histograma y no generan deriva.
+ */
+
+void test_task_timing_on_time_activations(void) {
+    task_timing_t timing;
+
+    TaskTimingInit(&timing, 100, 3);
+    for (uint32_t index = 1; index <= 10; index++) {
+        TaskTimingActivation(&timing, 100 + 3 * index);
+    }
+
+    TEST_ASSERT_EQUAL(10, timing.activations);
+    TEST_ASSERT_EQUAL(10, timing.histogram[TASK_TIMING_BINS / 2]);
+    TEST_ASSERT_EQUAL(0, timing.drift);
+    TEST_ASSERT_EQUAL(0, timing.max_drift);
+}
+
+/**
+ * @brief Verifica el registro de una activación atrasada, la recuperación posterior y la saturación de los extremos
+ * del histograma.
+ */
+
+void test_task_timing_late_activation_and_catch_up(void) {
+    task_timing_t timing;
+
+    TaskTimingInit(&timing, 0, 2);
+    TaskTimingActivation(&timing, 2);
+    TaskTimingActivation(&timing, 5);   // Un tick tarde
+    TEST_ASSERT_EQUAL(1, timing.drift);
+    TaskTimingActivation(&timing, 6);   // Se recupera el plazo
+    TEST_ASSERT_EQUAL(0, timing.drift);
+    TEST_ASSERT_EQUAL(1, timing.max_drift);
+    TEST_ASSERT_EQUAL(1, timing.histogram[TASK_TIMING_BINS / 2 + 1]);
+    TEST_ASSERT_EQUAL(1, timing.histogram[TASK_TIMING_BINS / 2 - 1]);
+
+    TaskTimingActivation(&timing, 60);
+    TEST_ASSERT_EQUAL(1, timing.histogram[TASK_TIMING_BINS - 1]);
+}
+
+/**
+ * @brief Verifica que la deriva se calcula bien cuando el contador de ticks del sistema da la vuelta.
+ */
+
+void test_task_timing_tick_counter_wraps(void) {
+    task_timing_t timing;
+
+    TaskTimingInit(&timing, UINT32_MAX - 1, 2);
+    TaskTimingActivation(&timing, 0);
+    TaskTimingActivation(&timing, 2);
+
+    TEST_ASSERT_EQUAL(0, timing.drift);
+    TEST_ASSERT_EQUAL(2, timing.histogram[TASK_TIMING_BINS / 2]);
+}
+
+/**
+ * @brief Simula un día completo con plazo absoluto: a pesar de las demoras, el reloj avanza exactamente un tick
+ * por cada tick del sistema y no acumula deriva.
+ */
+
+void test_task_timing_absolute_deadline_has_no_drift_in_a_day(void) {
+    task_timing_t timing;
+    clock_time_t result;
+    clock_t clock = ClockCreate(1000);
+
+    ClockSetTime(clock, &(clock_time_t){0});
+    TEST_ASSERT_EQUAL(TICKS_PER_DAY, SimulateClockTask(clock, &timing, true, TICKS_PER_DAY));
+    TEST_ASSERT_EQUAL(0, timing.drift);
+    TEST_ASSERT_LESS_OR_EQUAL(3, timing.max_drift);
+
+    ClockGetTime(clock, &result);
+    TEST_ASSERT_EACH_EQUAL_UINT8(0, result.bcd, sizeof(result.bcd));
+    ClockDestroy(clock);
+}
+
+/**
+ * @brief Simula una hora con retardo relativo: cada demora se suma al período y el reloj queda atrasado.
+ */
+
+void test_task_timing_relative_delay_drifts(void) {
+    task_timing_t timing;
+    clock_time_t result;
+    clock_t clock = ClockCreate(1000);
+
+    ClockSetTime(clock, &(clock_time_t){0});
+    TEST_ASSERT_LESS_THAN(TICKS_PER_HOUR, SimulateClockTask(clock, &timing, false, TICKS_PER_HOUR));
+    TEST_ASSERT_GREATER_THAN(0, timing.drift);
+
+    ClockGetTime(clock, &result);
+    TEST_ASSERT_EQUAL_UINT8(0, result.time.hours[0]);
+    ClockDestroy(clock);
+}
+
+/* === End of documentation ==================================================================== */
+
+/** @} End of module definition for doxygen */
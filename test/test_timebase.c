@@ -0,0 +1,160 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Roldan JesusAlejandro <kechuroldanjesus@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+/** @file test_timebase.c
+ ** @brief Pruebas unitarias de la base de tiempo simulada del host haciendo avanzar el reloj, tal como lo hacen
+ * en la placa el tick de FreeRTOS o el temporizador, incluida la recuperación de los ticks después de dormir.
+ **/
+
+/* === Headers files inclusions =============================================================== */
+
+#include "unity.h"
+#include "timebase_host.h"
+#include "clock.h"
+
+/* === Macros definitions ====================================================================== */
+
+#define TICKS_PER_SECOND 100
+#define TEST_ASSERT_TIME_HOURS_MINUTES_EQUAL(expected_hours, expected_minutes, current_time)                     \
+    TEST_ASSERT_EQUAL_UINT8((expected_hours) % 10, current_time.time.hours[0]);                                 \
+    TEST_ASSERT_EQUAL_UINT8((expected_hours) / 10, current_time.time.hours[1]);                                 \
+    TEST_ASSERT_EQUAL_UINT8((expected_minutes) % 10, current_time.time.minutes[0]);                             \
+    TEST_ASSERT_EQUAL_UINT8((expected_minutes) / 10, current_time.time.minutes[1])
+
+/* === Private data type declarations ========================================================== */
+
+/* === Private variable declarations =========================================================== */
+
+static uint32_t alarms_fired;
+
+/* === Private function declarations =========================================================== */
+
+static void ClockTickHandler(uint32_t ticks, void * context);
+
+/* === Public variable definitions ============================================================= */
+
+/* === Private variable definitions ============================================================ */
+
+/* === Private function implementation ========================================================= */
+
+static void ClockTickHandler(uint32_t ticks, void * context) {
+    (void)context;
+    // Igual que ClockNewTickFromISR en la placa
+    bool alarm_fired = (ticks == 1) ? ClockNewTickAll() : ClockAdvanceTicksAll(ticks);
+    if (alarm_fired) {
+        alarms_fired++;
+    }
+}
+
+/* === Public function implementation ========================================================= */
+
+void setUp(void) {
+    alarms_fired = 0;
+}
+
+void tearDown(void) {
+    TimebaseHost()->Stop();
+}
+
+/**
+ * @brief Verifica que la base de tiempo hace avanzar el reloj y dispara la alarma sin ninguna tarea.
+ */
+
+void test_timebase_drives_clock_and_alarm(void) {
+    clock_time_t result;
+    clock_t clock = ClockCreate(TICKS_PER_SECOND);
+
+    ClockSetTime(clock, &(clock_time_t){0});
+    ClockSetAlarm(clock, &(clock_time_t){ .time = { .minutes = {0, 3} } });  // 00:30
+    ClockEnableAlarm(clock);
+
+    TEST_ASSERT_TRUE(TimebaseHost()->Start(TICKS_PER_SECOND, ClockTickHandler, NULL));
+    TEST_ASSERT_EQUAL(TICKS_PER_SECOND, TimebaseHostFrequency());
+    TimebaseHostAdvance(3600 * TICKS_PER_SECOND);
+
+    ClockGetTime(clock, &result);
+    TEST_ASSERT_TIME_HOURS_MINUTES_EQUAL(1, 0, result);
+    TEST_ASSERT_EQUAL(1, alarms_fired);
+    ClockDestroy(clock);
+}
+
+/**
+ * @brief Verifica que una base de tiempo detenida no genera más ticks y que no acepta una frecuencia nula.
+ */
+
+void test_timebase_stop_and_invalid_start(void) {
+    clock_time_t result;
+    clock_t clock = ClockCreate(TICKS_PER_SECOND);
+
+    ClockSetTime(clock, &(clock_time_t){0});
+    TimebaseHost()->Start(TICKS_PER_SECOND, ClockTickHandler, NULL);
+    TimebaseHostAdvance(60 * TICKS_PER_SECOND);
+    TimebaseHost()->Stop();
+    TimebaseHostAdvance(60 * TICKS_PER_SECOND);
+
+    ClockGetTime(clock, &result);
+    TEST_ASSERT_TIME_HOURS_MINUTES_EQUAL(0, 1, result);
+    TEST_ASSERT_EQUAL(0, TimebaseHostFrequency());
+    TEST_ASSERT_FALSE(TimebaseHost()->Start(0, ClockTickHandler, NULL));
+    ClockDestroy(clock);
+}
+
+/**
+ * @brief Simula un día en bajo consumo, alternando ratos despierto con reposos de distinta duración: al reanudar
+ * la base de tiempo el reloj recupera todos los ticks dormidos y no pierde la alarma que cae durante un reposo.
+ */
+
+void test_timebase_sleep_catch_up_loses_no_time(void) {
+    clock_time_t result;
+    clock_t clock = ClockCreate(TICKS_PER_SECOND);
+    timebase_driver_t timebase = TimebaseHost();
+    uint32_t elapsed = 0;
+    uint32_t asleep = 0;
+    uint32_t sleep_length = 1;
+
+    ClockSetTime(clock, &(clock_time_t){0});
+    ClockSetAlarm(clock, &(clock_time_t){ .time = { .hours = {7, 0} } });
+    ClockEnableAlarm(clock);
+    timebase->Start(TICKS_PER_SECOND, ClockTickHandler, NULL);
+
+    while (elapsed < 86400 * TICKS_PER_SECOND) {
+        TimebaseHostAdvance(3);
+        elapsed += 3;
+
+        sleep_length = (sleep_length * 7 + 3) % 500;  // Reposos de 0 a 5 segundos
+        if (elapsed + sleep_length > 86400 * TICKS_PER_SECOND) {
+            sleep_length = 86400 * TICKS_PER_SECOND - elapsed;
+        }
+        timebase->Suspend();
+        TimebaseHostAdvance(sleep_length);
+        asleep += timebase->Resume();
+        elapsed += sleep_length;
+    }
+
+    ClockGetTime(clock, &result);
+    TEST_ASSERT_EACH_EQUAL_UINT8(0, result.bcd, sizeof(result.bcd));
+    // Solo el cruce del comienzo del minuto de la alarma la informa, aunque se despierte varias veces dentro de él
+    TEST_ASSERT_EQUAL(1, alarms_fired);
+    TEST_ASSERT_GREATER_THAN(elapsed / 2, asleep);
+    ClockDestroy(clock);
+}
+
+/* === End of documentation ==================================================================== */
+
+/** @} End of module definition for doxygen */